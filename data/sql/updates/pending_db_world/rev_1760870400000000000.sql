@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `name`='debug achievementbench';
+INSERT INTO `command` (`name`,`security`,`help`) VALUES
+('debug achievementbench',3,'Syntax: .debug achievementbench #creatureEntry [#iterations]\nTimes the achievement criteria lookup for kills of the given creature by the selected player, through the criteria index and as a full scan of all kill criteria. No progress is changed.');
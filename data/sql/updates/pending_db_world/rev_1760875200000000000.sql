@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `name`='debug lfgbench';
+INSERT INTO `command` (`name`,`security`,`help`) VALUES
+('debug lfgbench',3,'Syntax: .debug lfgbench [#players]\nQueues the given number of fake players (default 2000) with random roles and dungeons in a private LFG queue and times the group matching, with and without the role and dungeon masks. Real queues are not touched.');
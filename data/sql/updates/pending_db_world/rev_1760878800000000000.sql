@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `name`='debug broadcastbench';
+INSERT INTO `command` (`name`,`security`,`help`) VALUES
+('debug broadcastbench',3,'Syntax: .debug broadcastbench [#receivers] [#packetSize] [#iterations]\nTimes queueing one packet (default 64 bytes) to the sockets of the given number of receivers (default 500), once with a payload shared by all receivers and once with a copy per receiver as single sends do. Nothing is sent.');
@@ -169,6 +169,13 @@ elseif (WITH_DETAILED_METRICS)
   add_definitions(-DWITH_DETAILED_METRICS)
 endif()
 
+if(WITHOUT_OBJECT_POOLS)
+  message("")
+  message(" *** WITHOUT_OBJECT_POOLS - WARNING!")
+  message(" *** Please note that spells, spell events and aura applications will use the global allocator")
+  add_definitions(-DACORE_NO_OBJECT_POOLS)
+endif()
+
 if(MSAN)
     message("")
     message(" *** MSAN - WARNING!")
@@ -187,7 +194,7 @@ if(TSAN)
     message("")
     message(" *** TSAN - WARNING!")
     message(" *** Please note that this is for DEBUGGING WITH THREAD SANITIZER only!")
-    add_definitions(-DTSAN -DNO_BUFFERPOOL)
+    add_definitions(-DTSAN -DNO_BUFFERPOOL -DACORE_NO_OBJECT_POOLS)
 endif()
 
 if(BUILD_SHARED_LIBS)
@@ -22,6 +22,7 @@
 #include "DetourAlloc.h"
 #include "DetourExtended.h"
 #include "DetourNavMesh.h"
+#include <mutex>
 #include <shared_mutex>
 #include <unordered_map>
 #include <vector>
@@ -83,7 +84,7 @@ namespace MMAP
         bool unloadMap(uint32 mapId);
         bool unloadMapInstance(uint32 mapId, uint32 instanceId);
 
-        // the returned [dtNavMeshQuery const*] is NOT threadsafe
+        // the returned [dtNavMeshQuery const*] is NOT threadsafe, maps keep the one of their instance, see Map::GetNavMeshQuery
         dtNavMeshQuery const* GetNavMeshQuery(uint32 mapId, uint32 instanceId);
         dtNavMesh const* GetNavMesh(uint32 mapId);
 
@@ -98,6 +99,7 @@ namespace MMAP
         MMapDataSet loadedMMaps;
         uint32 loadedTiles{0};
         bool thread_safe_environment{true};
+        std::mutex _navMeshQueryLock;                   // instances of one map are created and destroyed by different map threads
     };
 }
 
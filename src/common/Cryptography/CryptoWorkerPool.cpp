@@ -0,0 +1,112 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CryptoWorkerPool.h"
+#include "Errors.h"
+
+Acore::Crypto::CryptoWorkerPool* Acore::Crypto::CryptoWorkerPool::instance()
+{
+    static CryptoWorkerPool instance;
+    return &instance;
+}
+
+Acore::Crypto::CryptoWorkerPool::~CryptoWorkerPool()
+{
+    Stop();
+}
+
+void Acore::Crypto::CryptoWorkerPool::Start(uint32 threadCount, uint32 maxQueuedTasks)
+{
+    ASSERT(_threads.empty(), "CryptoWorkerPool started twice");
+
+    _stopping = false;
+    _maxQueuedTasks = maxQueuedTasks;
+    for (uint32 i = 0; i < threadCount; ++i)
+        _threads.emplace_back(&CryptoWorkerPool::WorkerThread, this);
+}
+
+void Acore::Crypto::CryptoWorkerPool::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _stopping = true;
+    }
+
+    _condition.notify_all();
+
+    for (std::thread& thread : _threads)
+        thread.join();
+
+    _threads.clear();
+
+    // whoever waits for these still gets its result
+    for (std::packaged_task<void()>& task : _queue)
+        task();
+
+    _queue.clear();
+    _queueDepth = 0;
+}
+
+Acore::Crypto::CryptoTaskCallback Acore::Crypto::CryptoWorkerPool::Submit(std::function<void()>&& task, std::function<void()>&& callback)
+{
+    std::packaged_task<void()> packagedTask(std::move(task));
+    std::future<void> result = packagedTask.get_future();
+
+    bool started;
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        started = !_threads.empty() && !_stopping;
+        if (started && _queue.size() < _maxQueuedTasks)
+        {
+            _queue.push_back(std::move(packagedTask));
+            _queueDepth.store(uint32(_queue.size()), std::memory_order_relaxed);
+        }
+    }
+
+    // moved into the queue unless the pool is not started or full
+    if (packagedTask.valid())
+    {
+        if (started)
+            _inlineTasks.fetch_add(1, std::memory_order_relaxed);
+
+        packagedTask();
+    }
+    else
+        _condition.notify_one();
+
+    return CryptoTaskCallback(std::move(result), std::move(callback));
+}
+
+void Acore::Crypto::CryptoWorkerPool::WorkerThread()
+{
+    for (;;)
+    {
+        std::packaged_task<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _condition.wait(lock, [this]() { return _stopping || !_queue.empty(); });
+            if (_stopping)
+                return;
+
+            task = std::move(_queue.front());
+            _queue.pop_front();
+            _queueDepth.store(uint32(_queue.size()), std::memory_order_relaxed);
+        }
+
+        task();
+    }
+}
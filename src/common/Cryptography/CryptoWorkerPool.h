@@ -0,0 +1,98 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_CRYPTO_WORKER_POOL_H
+#define ACORE_CRYPTO_WORKER_POOL_H
+
+#include "Define.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Acore::Crypto
+{
+    /// Completion of a task run by the CryptoWorkerPool, processed by an AsyncCallbackProcessor on the thread that submitted it
+    class CryptoTaskCallback
+    {
+    public:
+        CryptoTaskCallback(std::future<void>&& result, std::function<void()>&& callback)
+            : _result(std::move(result)), _callback(std::move(callback)) { }
+
+        CryptoTaskCallback(CryptoTaskCallback&&) = default;
+        CryptoTaskCallback& operator=(CryptoTaskCallback&&) = default;
+
+        bool InvokeIfReady()
+        {
+            if (_result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                return false;
+
+            _callback();
+            return true;
+        }
+
+    private:
+        std::future<void> _result;
+        std::function<void()> _callback;
+    };
+
+    /**
+     * Bounded pool of threads running the CPU heavy parts of authentication (SRP6 exponentiations, Argon2 hashing),
+     * so that a login storm does not stall the network thread every other connection is served by.
+     * A task runs on the submitting thread when the pool is not started or its queue is full.
+     */
+    class AC_COMMON_API CryptoWorkerPool
+    {
+    public:
+        static CryptoWorkerPool* instance();
+
+        void Start(uint32 threadCount, uint32 maxQueuedTasks);
+        void Stop();
+
+        /// Runs the task on a worker thread, the callback is invoked by the processor of the returned object once the task finished
+        CryptoTaskCallback Submit(std::function<void()>&& task, std::function<void()>&& callback);
+
+        uint32 GetQueueDepth() const { return _queueDepth.load(std::memory_order_relaxed); }
+
+        /// Tasks that ran on the submitting thread because the queue was full, since the previous call
+        uint32 TakeInlineTaskCount() { return _inlineTasks.exchange(0, std::memory_order_relaxed); }
+
+    private:
+        CryptoWorkerPool() = default;
+        ~CryptoWorkerPool();
+
+        void WorkerThread();
+
+        std::mutex _lock;
+        std::condition_variable _condition;
+        std::deque<std::packaged_task<void()>> _queue;
+        std::vector<std::thread> _threads;
+        uint32 _maxQueuedTasks = 0;
+        bool _stopping = false;
+
+        std::atomic<uint32> _queueDepth{0};
+        std::atomic<uint32> _inlineTasks{0};
+    };
+}
+
+#define sCryptoWorkerPool Acore::Crypto::CryptoWorkerPool::instance()
+
+#endif // ACORE_CRYPTO_WORKER_POOL_H
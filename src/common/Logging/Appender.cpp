@@ -57,6 +57,14 @@ void Appender::write(LogMessage* message)
         return;
     }
 
+    if (!(flags & (APPENDER_FLAGS_PREFIX_TIMESTAMP | APPENDER_FLAGS_PREFIX_LOGLEVEL | APPENDER_FLAGS_PREFIX_LOGFILTERTYPE)))
+    {
+        // the message is shared by all appenders, don't print the prefix of the previous one
+        message->prefix.clear();
+        _write(message);
+        return;
+    }
+
     std::ostringstream ss;
 
     if (flags & APPENDER_FLAGS_PREFIX_TIMESTAMP)
@@ -42,6 +42,7 @@ public:
     void write(LogMessage* message);
     static char const* getLogLevelString(LogLevel level);
     virtual void setRealmId(uint32 /*realmId*/) { }
+    virtual void Flush() { }                 // called after every batch of asynchronous messages, synchronous logging leaves buffering to the appender
 
 private:
     virtual void _write(LogMessage const* /*message*/) = 0;
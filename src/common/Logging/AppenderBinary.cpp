@@ -0,0 +1,90 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AppenderBinary.h"
+#include "ByteConverter.h"
+#include "Log.h"
+#include "LogMessage.h"
+#include "StringFormat.h"
+#include <algorithm>
+
+AppenderBinary::AppenderBinary(uint8 id, std::string const& name, LogLevel level, AppenderFlags flags, std::vector<std::string_view> const& args) :
+    Appender(id, name, level, flags), _file(nullptr)
+{
+    if (args.size() < 4)
+    {
+        throw InvalidAppenderArgsException(Acore::StringFormatFmt("Log::CreateAppenderFromConfig: Missing file name for appender {}", name));
+    }
+
+    std::string fileName(args[3]);
+    if (flags & APPENDER_FLAGS_USE_TIMESTAMP)
+    {
+        size_t dot_pos = fileName.find_last_of('.');
+        if (dot_pos != std::string::npos)
+        {
+            fileName.insert(dot_pos, sLog->GetLogsTimestamp());
+        }
+        else
+        {
+            fileName += sLog->GetLogsTimestamp();
+        }
+    }
+
+    std::string mode = args.size() > 4 && args[4] == "w" ? "wb" : "ab";
+    _file = fopen((sLog->GetLogsDir() + fileName).c_str(), mode.c_str());
+    if (!_file)
+    {
+        throw InvalidAppenderArgsException(Acore::StringFormatFmt("Log::CreateAppenderFromConfig: Cannot open file {} for appender {}", fileName, name));
+    }
+
+    setvbuf(_file, nullptr, _IOFBF, 64 * 1024);
+
+    if (!ftell(_file))
+    {
+        fwrite(FILE_MAGIC, 1, sizeof(FILE_MAGIC), _file);
+        fwrite(&FILE_VERSION, 1, 1, _file);
+    }
+}
+
+AppenderBinary::~AppenderBinary()
+{
+    if (_file)
+        fclose(_file);
+}
+
+void AppenderBinary::_write(LogMessage const* message)
+{
+    uint8 typeLength = uint8(std::min<std::size_t>(message->type.size(), 0xFF));
+    uint32 size = RECORD_FIXED_SIZE + typeLength + uint32(message->text.size());
+    int64 time = int64(message->mtime.count());
+    uint8 level = message->level;
+
+    EndianConvert(size);
+    EndianConvert(time);
+
+    fwrite(&size, sizeof(size), 1, _file);
+    fwrite(&time, sizeof(time), 1, _file);
+    fwrite(&level, sizeof(level), 1, _file);
+    fwrite(&typeLength, sizeof(typeLength), 1, _file);
+    fwrite(message->type.data(), 1, typeLength, _file);
+    fwrite(message->text.data(), 1, message->text.size(), _file);
+}
+
+void AppenderBinary::Flush()
+{
+    fflush(_file);
+}
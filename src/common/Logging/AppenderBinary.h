@@ -0,0 +1,52 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef APPENDERBINARY_H
+#define APPENDERBINARY_H
+
+#include "Appender.h"
+#include <cstdio>
+
+/**
+ * Writes messages as length prefixed binary records into a buffered file that is only flushed after
+ * every batch of messages, instead of formatting a text prefix and flushing every line.
+ * Read the files with the log_decoder tool.
+ *
+ * File layout, all integers little endian:
+ *   header  "ACLOG" uint8 version
+ *   record  uint32 size (of the rest of the record), int64 unix time, uint8 level, uint8 type length, type, text
+ */
+class AppenderBinary : public Appender
+{
+public:
+    static constexpr AppenderType type = APPENDER_BINARY;
+    static constexpr char FILE_MAGIC[5] = { 'A', 'C', 'L', 'O', 'G' };
+    static constexpr uint8 FILE_VERSION = 1;
+    static constexpr uint32 RECORD_FIXED_SIZE = 8 + 1 + 1;
+
+    AppenderBinary(uint8 id, std::string const& name, LogLevel level, AppenderFlags flags, std::vector<std::string_view> const& args);
+    ~AppenderBinary();
+    AppenderType getType() const override { return type; }
+    void Flush() override;
+
+private:
+    void _write(LogMessage const* message) override;
+
+    FILE* _file;
+};
+
+#endif
@@ -16,6 +16,7 @@
  */
 
 #include "Log.h"
+#include "AppenderBinary.h"
 #include "AppenderConsole.h"
 #include "AppenderFile.h"
 #include "Config.h"
@@ -29,13 +30,46 @@
 #include "Timer.h"
 #include "Tokenize.h"
 #include <chrono>
+#include <mutex>
 #include <sstream>
 
-Log::Log() : AppenderId(0), highestLogLevel(LOG_LEVEL_FATAL)
+namespace
+{
+    struct LogRecordQueueRegistry
+    {
+        std::mutex Lock;
+        std::vector<std::weak_ptr<LogRecordQueue>> Queues;
+    };
+
+    LogRecordQueueRegistry& GetQueueRegistry()
+    {
+        static LogRecordQueueRegistry registry;
+        return registry;
+    }
+
+    std::shared_ptr<LogRecordQueue> const& GetThreadQueue()
+    {
+        static thread_local std::shared_ptr<LogRecordQueue> queue = []()
+        {
+            std::shared_ptr<LogRecordQueue> newQueue = std::make_shared<LogRecordQueue>();
+
+            LogRecordQueueRegistry& registry = GetQueueRegistry();
+            std::lock_guard<std::mutex> lock(registry.Lock);
+            std::erase_if(registry.Queues, [](std::weak_ptr<LogRecordQueue> const& queue) { return queue.expired(); });
+            registry.Queues.push_back(newQueue);
+            return newQueue;
+        }();
+
+        return queue;
+    }
+}
+
+Log::Log() : AppenderId(0), highestLogLevel(LOG_LEVEL_FATAL), _ioContext(nullptr), _strand(nullptr), _configGeneration(1)
 {
     m_logsTimestamp = "_" + GetTimestampStr();
     RegisterAppender<AppenderConsole>();
     RegisterAppender<AppenderFile>();
+    RegisterAppender<AppenderBinary>();
 }
 
 Log::~Log()
@@ -242,6 +276,8 @@ void Log::_outCommand(std::string_view message, std::string_view param1)
 void Log::write(std::unique_ptr<LogMessage>&& msg) const
 {
     Logger const* logger = GetLoggerByType(msg->type);
+    if (!logger)
+        return;
 
     if (_ioContext)
     {
@@ -252,6 +288,63 @@ void Log::write(std::unique_ptr<LogMessage>&& msg) const
         logger->write(msg.get());
 }
 
+LogRecord* Log::GetFreeThreadRecord()
+{
+    // a full queue means the strand fell behind, the caller falls back to posting the message on its own
+    return GetThreadQueue()->GetFreeRecord();
+}
+
+void Log::CommitThreadRecord(LogRecord* record)
+{
+    record->Time = GetEpochTime();
+
+    std::shared_ptr<LogRecordQueue> const& queue = GetThreadQueue();
+    queue->CommitRecord();
+
+    // one drain per batch of records instead of one post per message
+    if (!queue->DrainScheduled.exchange(true))
+        Acore::Asio::post(*_ioContext, Acore::Asio::bind_executor(*_strand, [this, queue]() { DrainQueue(*queue); }));
+}
+
+void Log::DrainQueue(LogRecordQueue& queue) const
+{
+    // cleared first, records committed from now on schedule another drain
+    queue.DrainScheduled.store(false);
+
+    queue.Consume([this](LogRecord& record)
+    {
+        if (record.HasDeferredArgs())
+        {
+            record.Text = record.FormatDeferredArgs();
+            record.ResetDeferredArgs();
+        }
+
+        LogMessage message(record.Level, std::string(record.GetType()), record.Text);
+        message.mtime = record.Time;
+
+        if (Logger const* logger = GetLoggerByType(message.type))
+            logger->write(&message);
+    });
+
+    for (std::pair<uint8 const, std::unique_ptr<Appender>> const& appender : appenders)
+        appender.second->Flush();
+}
+
+void Log::DrainAllQueues() const
+{
+    LogRecordQueueRegistry& registry = GetQueueRegistry();
+    std::lock_guard<std::mutex> lock(registry.Lock);
+    for (std::weak_ptr<LogRecordQueue> const& weakQueue : registry.Queues)
+        if (std::shared_ptr<LogRecordQueue> queue = weakQueue.lock())
+            DrainQueue(*queue);
+}
+
+LogLevel Log::GetLogLevel(std::string const& type) const
+{
+    Logger const* logger = GetLoggerByType(type);
+    return logger ? logger->getLogLevel() : LOG_LEVEL_DISABLED;
+}
+
 Logger const* Log::GetLoggerByType(std::string const& type) const
 {
     auto it = loggers.find(type);
@@ -303,6 +396,7 @@ bool Log::SetLogLevel(std::string const& name, int32 newLeveli, bool isLogger /*
         }
 
         it->second->setLogLevel(newLevel);
+        ++_configGeneration;
 
         if (newLevel != LOG_LEVEL_DISABLED && newLevel > highestLogLevel)
         {
@@ -335,6 +429,7 @@ void Log::Close()
 {
     loggers.clear();
     appenders.clear();
+    ++_configGeneration;
 }
 
 bool Log::ShouldLog(std::string const& type, LogLevel level) const
@@ -378,6 +473,9 @@ void Log::Initialize(Acore::Asio::IoContext* ioContext)
 
 void Log::SetSynchronous()
 {
+    // the strand will not run anymore, write what the threads left behind
+    DrainAllQueues();
+
     delete _strand;
     _strand = nullptr;
     _ioContext = nullptr;
@@ -399,6 +497,7 @@ void Log::LoadFromConfig()
 
     ReadAppendersFromConfig();
     ReadLoggersFromConfig();
+    ++_configGeneration;
 
     _debugLogMask = DebugLogFilters(sConfigMgr->GetOption<uint32>("DebugLogMask", LOG_FILTER_NONE, false));
 }
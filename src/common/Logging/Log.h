@@ -20,8 +20,11 @@
 
 #include "Define.h"
 #include "LogCommon.h"
+#include "LogRecord.h"
 #include "StringFormat.h"
+#include <atomic>
 #include <memory>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -67,12 +70,51 @@ public:
     [[nodiscard]] bool ShouldLog(std::string const& type, LogLevel level) const;
     bool SetLogLevel(std::string const& name, int32 level, bool isLogger = true);
 
+    /// Level of the logger handling the given type, LOG_LEVEL_DISABLED when there is none
+    [[nodiscard]] LogLevel GetLogLevel(std::string const& type) const;
+
+    /// Changes every time loggers are created or their levels change, see LogCategoryHandle
+    [[nodiscard]] uint32 GetConfigGeneration() const { return _configGeneration.load(std::memory_order_relaxed); }
+
     template<typename... Args>
     inline void outMessage(std::string const& filter, LogLevel const level, std::string_view fmt, Args&&... args)
     {
         _outMessage(filter, level, Acore::StringFormatFmt(fmt, std::forward<Args>(args)...));
     }
 
+    /// Used by the LOG_* macros. With asynchronous logging the message goes to the calling thread's LogRecordQueue and,
+    /// when all arguments can be copied, is only formatted on the logging strand.
+    template<typename Filter, typename... Args>
+    void outDeferredMessage(Filter const& filter, LogLevel const level, fmt::format_string<Args...> fmt, Args&&... args)
+    {
+        LogRecord* record = _ioContext ? GetFreeThreadRecord() : nullptr;
+        if (!record)
+        {
+            // synchronous logging or a full ring: the records in the ring are drained by a handler that was posted
+            // to the strand before this message, so the messages of this thread still come out in order
+            _outMessage(std::string(filter), level, fmt::format(fmt, std::forward<Args>(args)...));
+            return;
+        }
+
+        record->Level = level;
+        if constexpr (std::is_array_v<Filter>)
+            record->StaticType = filter;
+        else
+        {
+            record->StaticType = {};
+            record->Type = filter;
+        }
+
+        fmt::string_view format = fmt;
+        if (!record->TryDeferArgs(std::string_view(format.data(), format.size()), std::forward<Args>(args)...))
+        {
+            record->Text.clear();
+            fmt::format_to(std::back_inserter(record->Text), fmt, std::forward<Args>(args)...);
+        }
+
+        CommitThreadRecord(record);
+    }
+
     template<typename... Args>
     void outCommand(uint32 account, std::string_view fmt, Args&&... args)
     {
@@ -99,6 +141,11 @@ private:
     static std::string GetTimestampStr();
     void write(std::unique_ptr<LogMessage>&& msg) const;
 
+    LogRecord* GetFreeThreadRecord();
+    void CommitThreadRecord(LogRecord* record);
+    void DrainQueue(LogRecordQueue& queue) const;
+    void DrainAllQueues() const;
+
     [[nodiscard]] Logger const* GetLoggerByType(std::string const& type) const;
     Appender* GetAppenderByName(std::string_view name);
     uint8 NextAppenderId();
@@ -121,17 +168,50 @@ private:
 
     Acore::Asio::IoContext* _ioContext;
     Acore::Asio::Strand* _strand;
+    std::atomic<uint32> _configGeneration;
     // Deprecated debug filter logs
     DebugLogFilters _debugLogMask;
 };
 
 #define sLog Log::instance()
 
+/// Level of one LOG_* call site, looked up again only after the logger configuration changed
+class LogCategoryHandle
+{
+public:
+    constexpr LogCategoryHandle() = default;
+
+    template<std::size_t N>
+    bool ShouldLog(char const (&type)[N], LogLevel level)
+    {
+        // generation and level are packed so a concurrent refresh never mixes two configurations
+        uint32 generation = sLog->GetConfigGeneration();
+        uint32 cached = _cached.load(std::memory_order_relaxed);
+        if ((cached >> 8) != generation)
+        {
+            cached = (generation << 8) | sLog->GetLogLevel(type);
+            _cached.store(cached, std::memory_order_relaxed);
+        }
+
+        LogLevel logLevel = LogLevel(cached & 0xFF);
+        return logLevel != LOG_LEVEL_DISABLED && logLevel >= level;
+    }
+
+    // the category is only known at run time
+    bool ShouldLog(std::string const& type, LogLevel level)
+    {
+        return sLog->ShouldLog(type, level);
+    }
+
+private:
+    std::atomic<uint32> _cached = 0;
+};
+
 #define LOG_EXCEPTION_FREE(filterType__, level__, ...) \
     { \
         try \
         { \
-            sLog->outMessage(filterType__, level__, fmt::format(__VA_ARGS__)); \
+            sLog->outDeferredMessage(filterType__, level__, __VA_ARGS__); \
         } \
         catch (std::exception const& e) \
         { \
@@ -146,7 +226,8 @@ private:
 #define LOG_MESSAGE_BODY(filterType__, level__, ...)                        \
         do                                                              \
         {                                                               \
-            if (sLog->ShouldLog(filterType__, level__))                 \
+            static LogCategoryHandle __ac_log_category;                 \
+            if (__ac_log_category.ShouldLog(filterType__, level__))     \
                 LOG_EXCEPTION_FREE(filterType__, level__, __VA_ARGS__); \
         } while (0)
 #endif
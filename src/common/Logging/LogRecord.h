@@ -0,0 +1,205 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LogRecord_h__
+#define LogRecord_h__
+
+#include "Define.h"
+#include "Duration.h"
+#include "LogCommon.h"
+#include <fmt/format.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace Acore::Impl
+{
+    struct NotDeferrableLogArg { };
+
+    /// Argument types that can be copied into a LogRecord and formatted later on the logging thread.
+    /// Everything else (pointers to game objects, views, custom formattable types) is formatted right away.
+    template<typename T, typename = void>
+    struct DeferredLogArg
+    {
+        static constexpr bool Deferrable = false;
+        using Type = NotDeferrableLogArg;
+    };
+
+    template<typename T>
+    struct DeferredLogArg<T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>>>
+    {
+        static constexpr bool Deferrable = true;
+        using Type = T;
+        static T Convert(T value) { return value; }
+    };
+
+    template<>
+    struct DeferredLogArg<std::string>
+    {
+        static constexpr bool Deferrable = true;
+        using Type = std::string;
+        template<typename String>
+        static std::string Convert(String&& value) { return std::forward<String>(value); }
+    };
+
+    template<>
+    struct DeferredLogArg<std::string_view>
+    {
+        static constexpr bool Deferrable = true;
+        using Type = std::string;
+        static std::string Convert(std::string_view value) { return std::string(value); }
+    };
+
+    template<>
+    struct DeferredLogArg<char const*>
+    {
+        static constexpr bool Deferrable = true;
+        using Type = std::string;
+        static std::string Convert(char const* value) { return value ? std::string(value) : std::string("(null)"); }
+    };
+
+    template<>
+    struct DeferredLogArg<char*> : DeferredLogArg<char const*> { };
+}
+
+/// One message waiting in a LogRecordQueue. Records are reused, so their strings keep their capacity.
+class LogRecord
+{
+public:
+    static constexpr std::size_t DEFERRED_ARGS_SIZE = 160;
+
+    LogRecord() = default;
+    ~LogRecord() { ResetDeferredArgs(); }
+
+    LogRecord(LogRecord const&) = delete;
+    LogRecord& operator=(LogRecord const&) = delete;
+
+    LogLevel Level = LOG_LEVEL_DISABLED;
+    Seconds Time = 0s;
+    std::string_view StaticType;            // category when it is a string literal
+    std::string Type;                       // category otherwise
+    std::string Text;                       // formatted text, unused while arguments are deferred
+
+    [[nodiscard]] std::string_view GetType() const { return StaticType.empty() ? std::string_view(Type) : StaticType; }
+    [[nodiscard]] bool HasDeferredArgs() const { return _formatDeferredArgs != nullptr; }
+
+    /// Copies the arguments into the record to format them later, false when one of them cannot be copied safely
+    template<typename... Args>
+    bool TryDeferArgs(std::string_view format, Args&&... args)
+    {
+        using Tuple = std::tuple<typename Acore::Impl::DeferredLogArg<std::decay_t<Args>>::Type...>;
+
+        if constexpr (!(Acore::Impl::DeferredLogArg<std::decay_t<Args>>::Deferrable && ...) || sizeof(Tuple) > DEFERRED_ARGS_SIZE || alignof(Tuple) > alignof(std::max_align_t))
+            return false;
+        else
+        {
+            new (_deferredArgs.data()) Tuple(Acore::Impl::DeferredLogArg<std::decay_t<Args>>::Convert(std::forward<Args>(args))...);
+            // copied, the format is not always a literal (runtime format strings built by the caller)
+            _format.assign(format);
+            _formatDeferredArgs = [](std::string_view format, void* storage) -> std::string
+            {
+                return std::apply([format](auto const&... values) { return fmt::format(fmt::runtime(format), values...); }, *static_cast<Tuple*>(storage));
+            };
+            _destroyDeferredArgs = [](void* storage) { static_cast<Tuple*>(storage)->~Tuple(); };
+            return true;
+        }
+    }
+
+    /// Formats the deferred arguments, on the logging thread
+    [[nodiscard]] std::string FormatDeferredArgs()
+    {
+        try
+        {
+            return _formatDeferredArgs(_format, _deferredArgs.data());
+        }
+        catch (std::exception const& e)
+        {
+            return fmt::format("Wrong format occurred ({}) in '{}'", e.what(), _format);
+        }
+    }
+
+    void ResetDeferredArgs()
+    {
+        if (_destroyDeferredArgs)
+            _destroyDeferredArgs(_deferredArgs.data());
+
+        _formatDeferredArgs = nullptr;
+        _destroyDeferredArgs = nullptr;
+    }
+
+private:
+    alignas(std::max_align_t) std::array<std::byte, DEFERRED_ARGS_SIZE> _deferredArgs;
+    std::string _format;                    // keeps its capacity like Text
+    std::string(*_formatDeferredArgs)(std::string_view, void*) = nullptr;
+    void(*_destroyDeferredArgs)(void*) = nullptr;
+};
+
+/**
+ * Fixed size single producer, single consumer ring of LogRecord.
+ * Every thread that logs owns one queue, the logging strand is the only consumer.
+ */
+class LogRecordQueue
+{
+public:
+    static constexpr std::size_t CAPACITY = 512;
+
+    LogRecordQueue() : _records(CAPACITY) { }
+
+    /// Record to fill before CommitRecord, nullptr when the logging thread fell behind
+    LogRecord* GetFreeRecord()
+    {
+        std::size_t head = _head.load(std::memory_order_relaxed);
+        if (head - _tail.load(std::memory_order_acquire) >= CAPACITY)
+            return nullptr;
+
+        return &_records[head % CAPACITY];
+    }
+
+    void CommitRecord()
+    {
+        _head.store(_head.load(std::memory_order_relaxed) + 1);
+    }
+
+    /// Calls the consumer for every committed record, oldest first
+    template<class Consumer>
+    void Consume(Consumer&& consumer)
+    {
+        std::size_t tail = _tail.load(std::memory_order_relaxed);
+        std::size_t head = _head.load();
+        for (; tail != head; ++tail)
+        {
+            consumer(_records[tail % CAPACITY]);
+            _tail.store(tail + 1, std::memory_order_release);
+        }
+    }
+
+    /// Set while a drain of this queue is posted to the logging strand
+    std::atomic<bool> DrainScheduled = false;
+
+private:
+    std::vector<LogRecord> _records;
+    std::atomic<std::size_t> _head = 0;
+    std::atomic<std::size_t> _tail = 0;
+};
+
+#endif // LogRecord_h__
@@ -23,6 +23,98 @@
 #include "Tokenize.h"
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <bit>
+#include <cstdio>
+#include <fstream>
+
+uint32 GetMetricShardIndex()
+{
+    static std::atomic<uint32> nextIndex = 0;
+    thread_local uint32 index = nextIndex++ % MetricHistogram::SHARD_COUNT;
+    return index;
+}
+
+uint32 MetricHistogram::GetBucket(uint64 value)
+{
+    if (value < SUB_BUCKETS)
+        return uint32(value);
+
+    uint32 exponent = uint32(std::bit_width(value)) - 1;
+    if (exponent >= MAX_EXPONENT)
+        return BUCKET_COUNT - 1;
+
+    uint32 subBucket = uint32(value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+    return SUB_BUCKETS + (exponent - SUB_BUCKET_BITS) * SUB_BUCKETS + subBucket;
+}
+
+uint64 MetricHistogram::GetBucketUpperBound(uint32 bucket)
+{
+    if (bucket < SUB_BUCKETS)
+        return bucket;
+
+    uint32 shift = (bucket - SUB_BUCKETS) / SUB_BUCKETS;
+    uint64 lowerBound = uint64(SUB_BUCKETS + (bucket - SUB_BUCKETS) % SUB_BUCKETS) << shift;
+    return lowerBound + (uint64(1) << shift) - 1;
+}
+
+int64 MetricCounter::GetValue() const
+{
+    int64 value = 0;
+    for (Shard const& shard : _shards)
+        value += shard.Value.load(std::memory_order_relaxed);
+
+    return value;
+}
+
+namespace
+{
+    constexpr std::array<uint32, 3> HistogramPercentiles = { 50, 90, 99 };
+
+    std::string FormatPrometheusLabels(std::string const& realmName, std::vector<MetricTag> const& tags, std::string_view extraLabel = {})
+    {
+        auto escape = [](std::string value)
+        {
+            boost::replace_all(value, "\\", "\\\\");
+            boost::replace_all(value, "\"", "\\\"");
+            boost::replace_all(value, "\n", "\\n");
+            return value;
+        };
+
+        std::string labels;
+        if (!realmName.empty())
+            labels += "realm=\"" + escape(realmName) + '"';
+
+        for (MetricTag const& tag : tags)
+        {
+            if (!labels.empty())
+                labels += ',';
+
+            labels += tag.first + "=\"" + escape(tag.second) + '"';
+        }
+
+        if (!extraLabel.empty())
+        {
+            if (!labels.empty())
+                labels += ',';
+
+            labels += extraLabel;
+        }
+
+        return labels.empty() ? labels : '{' + labels + '}';
+    }
+
+    template<class Handle>
+    std::vector<Handle const*> SortByCategory(std::deque<Handle> const& handles)
+    {
+        std::vector<Handle const*> sorted;
+        sorted.reserve(handles.size());
+        for (Handle const& handle : handles)
+            sorted.push_back(&handle);
+
+        std::stable_sort(sorted.begin(), sorted.end(), [](Handle const* left, Handle const* right) { return left->GetCategory() < right->GetCategory(); });
+        return sorted;
+    }
+}
 
 Metric::Metric()
 {
@@ -42,6 +134,7 @@ void Metric::Initialize(std::string const& realmName, Acore::Asio::IoContext& io
 {
     _dataStream = std::make_unique<boost::asio::ip::tcp::iostream>();
     _realmName = FormatInfluxDBTagValue(realmName);
+    _realmLabel = realmName;
     _batchTimer = std::make_unique<Acore::Asio::DeadlineTimer>(ioContext);
     _overallStatusTimer = std::make_unique<Acore::Asio::DeadlineTimer>(ioContext);
     _overallStatusLogger = overallStatusLogger;
@@ -86,6 +179,8 @@ void Metric::LoadFromConfigs()
         _overallStatusTimerInterval = 1;
     }
 
+    _exportFile = sConfigMgr->GetOption<std::string>("Metric.ExportFile", "");
+
     _thresholds.clear();
     std::vector<std::string> thresholdSettings = sConfigMgr->GetKeysByString("Metric.Threshold.");
     for (std::string const& thresholdSetting : thresholdSettings)
@@ -95,29 +190,38 @@ void Metric::LoadFromConfigs()
         _thresholds[thresholdName] = thresholdValue;
     }
 
+    {
+        std::lock_guard<std::mutex> lock(_handlesLock);
+        for (MetricHistogram& histogram : _histograms)
+            ApplyThreshold(histogram);
+    }
+
     // Schedule a send at this point only if the config changed from Disabled to Enabled.
     // Cancel any scheduled operation if the config changed from Enabled to Disabled.
     if (_enabled && !previousValue)
     {
         std::string connectionInfo = sConfigMgr->GetOption<std::string>("Metric.ConnectionInfo", "");
-        if (connectionInfo.empty())
+        _sendToDatabase = !connectionInfo.empty();
+        if (_sendToDatabase)
         {
-            LOG_ERROR("metric", "'Metric.ConnectionInfo' not specified in configuration file.");
-            return;
+            std::vector<std::string_view> tokens = Acore::Tokenize(connectionInfo, ';', true);
+            if (tokens.size() != 3)
+            {
+                LOG_ERROR("metric", "'Metric.ConnectionInfo' specified with wrong format in configuration file.");
+                return;
+            }
+
+            _hostname.assign(tokens[0]);
+            _port.assign(tokens[1]);
+            _databaseName.assign(tokens[2]);
+            Connect();
         }
-
-        std::vector<std::string_view> tokens = Acore::Tokenize(connectionInfo, ';', true);
-        if (tokens.size() != 3)
+        else if (_exportFile.empty())
         {
-            LOG_ERROR("metric", "'Metric.ConnectionInfo' specified with wrong format in configuration file.");
+            LOG_ERROR("metric", "Neither 'Metric.ConnectionInfo' nor 'Metric.ExportFile' specified in configuration file.");
             return;
         }
 
-        _hostname.assign(tokens[0]);
-        _port.assign(tokens[1]);
-        _databaseName.assign(tokens[2]);
-        Connect();
-
         ScheduleSend();
         ScheduleOverallStatusLog();
     }
@@ -158,6 +262,184 @@ void Metric::LogEvent(std::string const& category, std::string const& title, std
     _queuedData.Enqueue(data);
 }
 
+MetricHistogram& Metric::GetHistogram(std::string const& category, std::vector<MetricTag> tags)
+{
+    std::lock_guard<std::mutex> lock(_handlesLock);
+    auto itr = std::find_if(_histograms.begin(), _histograms.end(), [&](MetricHistogram const& histogram)
+    {
+        return histogram.GetCategory() == category && histogram.GetTags() == tags;
+    });
+
+    if (itr != _histograms.end())
+        return *itr;
+
+    MetricHistogram& histogram = _histograms.emplace_back(category, std::move(tags));
+    ApplyThreshold(histogram);
+    return histogram;
+}
+
+void Metric::ApplyThreshold(MetricHistogram& histogram) const
+{
+    // thresholds are in milliseconds like the ones of METRIC_DETAILED_TIMER, unlike those they are optional here
+    auto threshold = _thresholds.find(histogram.GetCategory());
+    histogram._threshold.store(threshold != _thresholds.end() ? uint64(std::max<int64>(0, threshold->second)) * 1000 : 0, std::memory_order_relaxed);
+}
+
+MetricCounter& Metric::GetCounter(std::string const& category, std::vector<MetricTag> tags)
+{
+    std::lock_guard<std::mutex> lock(_handlesLock);
+    auto itr = std::find_if(_counters.begin(), _counters.end(), [&](MetricCounter const& counter)
+    {
+        return counter.GetCategory() == category && counter.GetTags() == tags;
+    });
+
+    if (itr != _counters.end())
+        return *itr;
+
+    return _counters.emplace_back(category, std::move(tags));
+}
+
+void Metric::AppendAggregatedData(std::ostream& batchedData, bool& firstLine, std::string const& timestamp)
+{
+    auto appendSeries = [&](std::string const& category, std::vector<MetricTag> const& tags)
+    {
+        if (!firstLine)
+            batchedData << "\n";
+
+        firstLine = false;
+        batchedData << category;
+        if (!_realmName.empty())
+            batchedData << ",realm=" << _realmName;
+
+        for (MetricTag const& tag : tags)
+            batchedData << "," << tag.first << "=" << FormatInfluxDBTagValue(tag.second);
+
+        batchedData << " ";
+    };
+
+    std::lock_guard<std::mutex> lock(_handlesLock);
+    for (MetricHistogram& histogram : _histograms)
+    {
+        std::array<uint64, MetricHistogram::BUCKET_COUNT> totals = { };
+        uint64 totalSum = 0;
+        uint64 max = 0;
+        for (MetricHistogram::Shard& shard : histogram._shards)
+        {
+            for (uint32 bucket = 0; bucket < MetricHistogram::BUCKET_COUNT; ++bucket)
+                totals[bucket] += shard.Buckets[bucket].load(std::memory_order_relaxed);
+
+            totalSum += shard.Sum.load(std::memory_order_relaxed);
+            max = std::max(max, shard.Max.exchange(0, std::memory_order_relaxed));
+        }
+
+        // only what was recorded since the previous flush
+        std::array<uint64, MetricHistogram::BUCKET_COUNT> interval;
+        uint64 count = 0;
+        for (uint32 bucket = 0; bucket < MetricHistogram::BUCKET_COUNT; ++bucket)
+        {
+            interval[bucket] = totals[bucket] - histogram._flushedBuckets[bucket];
+            count += interval[bucket];
+        }
+
+        uint64 sum = totalSum - histogram._flushedSum;
+        histogram._flushedBuckets = totals;
+        histogram._flushedSum = totalSum;
+        if (!count)
+            continue;
+
+        std::array<uint64, HistogramPercentiles.size()> percentiles = { };
+        uint64 seen = 0;
+        std::size_t nextPercentile = 0;
+        for (uint32 bucket = 0; bucket < MetricHistogram::BUCKET_COUNT; ++bucket)
+        {
+            if (!interval[bucket])
+                continue;
+
+            seen += interval[bucket];
+            while (nextPercentile < percentiles.size() && seen * 100 >= count * HistogramPercentiles[nextPercentile])
+                percentiles[nextPercentile++] = MetricHistogram::GetBucketUpperBound(bucket);
+        }
+
+        histogram._lastPercentiles = percentiles;
+
+        // "value" is the slowest sample in milliseconds, the dashboards chart max("value") as they did for METRIC_TIMER
+        appendSeries(histogram.GetCategory(), histogram.GetTags());
+        batchedData << "value=" << FormatInfluxDBValue(max / 1000.0) << ",count=" << FormatInfluxDBValue(count)
+            << ",mean_us=" << FormatInfluxDBValue(sum / count);
+        for (std::size_t i = 0; i < percentiles.size(); ++i)
+            batchedData << ",p" << HistogramPercentiles[i] << "_us=" << FormatInfluxDBValue(percentiles[i]);
+
+        batchedData << ",max_us=" << FormatInfluxDBValue(max) << " " << timestamp;
+    }
+
+    for (MetricCounter& counter : _counters)
+    {
+        int64 value = counter.GetValue();
+        int64 interval = value - counter._flushedValue;
+        counter._flushedValue = value;
+        if (!interval)
+            continue;
+
+        appendSeries(counter.GetCategory(), counter.GetTags());
+        batchedData << "value=" << FormatInfluxDBValue(interval) << " " << timestamp;
+    }
+}
+
+void Metric::WriteExportFile()
+{
+    std::string tmpFile = _exportFile + ".tmp";
+    {
+        std::ofstream file(tmpFile, std::ios::out | std::ios::trunc);
+        if (!file)
+        {
+            LOG_ERROR("metric", "Cannot write metric export file '{}'", tmpFile);
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(_handlesLock);
+
+        std::string_view previousCategory;
+        for (MetricHistogram const* histogram : SortByCategory(_histograms))
+        {
+            if (histogram->GetCategory() != previousCategory)
+            {
+                previousCategory = histogram->GetCategory();
+                file << "# TYPE " << histogram->GetCategory() << "_us summary\n";
+            }
+
+            for (std::size_t i = 0; i < HistogramPercentiles.size(); ++i)
+            {
+                file << histogram->GetCategory() << "_us" << FormatPrometheusLabels(_realmLabel, histogram->GetTags(),
+                    Acore::StringFormat("quantile=\"{}\"", HistogramPercentiles[i] / 100.0)) << ' ' << histogram->_lastPercentiles[i] << '\n';
+            }
+
+            uint64 count = 0;
+            for (uint64 bucketCount : histogram->_flushedBuckets)
+                count += bucketCount;
+
+            std::string labels = FormatPrometheusLabels(_realmLabel, histogram->GetTags());
+            file << histogram->GetCategory() << "_us_sum" << labels << ' ' << histogram->_flushedSum << '\n';
+            file << histogram->GetCategory() << "_us_count" << labels << ' ' << count << '\n';
+        }
+
+        previousCategory = {};
+        for (MetricCounter const* counter : SortByCategory(_counters))
+        {
+            if (counter->GetCategory() != previousCategory)
+            {
+                previousCategory = counter->GetCategory();
+                file << "# TYPE " << counter->GetCategory() << "_total counter\n";
+            }
+
+            file << counter->GetCategory() << "_total" << FormatPrometheusLabels(_realmLabel, counter->GetTags()) << ' ' << counter->_flushedValue << '\n';
+        }
+    }
+
+    // replace the file at once so a scraper never reads half of it
+    if (std::rename(tmpFile.c_str(), _exportFile.c_str()) != 0)
+        LOG_ERROR("metric", "Cannot replace metric export file '{}'", _exportFile);
+}
+
 void Metric::SendBatch()
 {
     using namespace std::chrono;
@@ -196,6 +478,17 @@ void Metric::SendBatch()
         delete data;
     }
 
+    AppendAggregatedData(batchedData, firstLoop, std::to_string(duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count()));
+
+    if (!_exportFile.empty())
+        WriteExportFile();
+
+    if (!_sendToDatabase)
+    {
+        ScheduleSend();
+        return;
+    }
+
     // Check if there's any data to send
     if (batchedData.tellp() == std::streampos(0))
     {
@@ -21,9 +21,14 @@
 #include "Define.h"
 #include "Duration.h"
 #include "MPSCQueue.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
 #include <functional>
 #include <iosfwd>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -58,6 +63,109 @@ struct MetricData
     std::string Text;
 };
 
+/// Index of the calling thread in the shards of MetricHistogram and MetricCounter
+AC_COMMON_API uint32 GetMetricShardIndex();
+
+/**
+ * Pre-registered histogram of microsecond samples, recorded without locks.
+ * Buckets are log-linear like HDR histograms: 8 sub buckets per power of two, so every
+ * reported percentile is within 12.5% of the real value. Samples are aggregated per
+ * Metric.Interval and sent as a single line instead of one line per sample.
+ */
+class AC_COMMON_API MetricHistogram
+{
+public:
+    static constexpr uint32 SUB_BUCKET_BITS = 3;
+    static constexpr uint32 SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static constexpr uint32 MAX_EXPONENT = 40;
+    static constexpr uint32 BUCKET_COUNT = SUB_BUCKETS + (MAX_EXPONENT - SUB_BUCKET_BITS) * SUB_BUCKETS;
+    static constexpr uint32 SHARD_COUNT = 8;
+
+    MetricHistogram(std::string category, std::vector<MetricTag> tags) : _category(std::move(category)), _tags(std::move(tags)) { }
+
+    MetricHistogram(MetricHistogram const&) = delete;
+    MetricHistogram& operator=(MetricHistogram const&) = delete;
+
+    void Record(uint64 value)
+    {
+        Shard& shard = _shards[GetMetricShardIndex()];
+        shard.Buckets[GetBucket(value)].fetch_add(1, std::memory_order_relaxed);
+        shard.Sum.fetch_add(value, std::memory_order_relaxed);
+
+        uint64 max = shard.Max.load(std::memory_order_relaxed);
+        while (value > max && !shard.Max.compare_exchange_weak(max, value, std::memory_order_relaxed))
+        {
+            // another sample of this shard raced us, max holds its value now
+        }
+    }
+
+    /// Timer samples below the category's Metric.Threshold are dropped
+    void Record(std::chrono::nanoseconds duration)
+    {
+        uint64 value = uint64(std::max<int64>(0, std::chrono::duration_cast<Microseconds>(duration).count()));
+        if (value < _threshold.load(std::memory_order_relaxed))
+            return;
+
+        Record(value);
+    }
+
+    static uint32 GetBucket(uint64 value);
+    static uint64 GetBucketUpperBound(uint32 bucket);
+
+    std::string const& GetCategory() const { return _category; }
+    std::vector<MetricTag> const& GetTags() const { return _tags; }
+
+private:
+    friend class Metric;
+
+    struct alignas(64) Shard
+    {
+        std::array<std::atomic<uint64>, BUCKET_COUNT> Buckets = { };
+        std::atomic<uint64> Sum = 0;
+        std::atomic<uint64> Max = 0;                  // largest sample since the previous flush
+    };
+
+    std::string _category;
+    std::vector<MetricTag> _tags;
+    std::array<Shard, SHARD_COUNT> _shards;
+    std::atomic<uint64> _threshold = 0;               // in microseconds, set from the Metric.Threshold config
+
+    // totals at the previous flush, only used by the thread sending the batches
+    std::array<uint64, BUCKET_COUNT> _flushedBuckets = { };
+    uint64 _flushedSum = 0;
+    std::array<uint64, 3> _lastPercentiles = { }; // p50, p90 and p99 of the previous interval
+};
+
+/// Pre-registered counter, added to without locks and sent as one value per Metric.Interval
+class AC_COMMON_API MetricCounter
+{
+public:
+    MetricCounter(std::string category, std::vector<MetricTag> tags) : _category(std::move(category)), _tags(std::move(tags)) { }
+
+    MetricCounter(MetricCounter const&) = delete;
+    MetricCounter& operator=(MetricCounter const&) = delete;
+
+    void Add(int64 value) { _shards[GetMetricShardIndex()].Value.fetch_add(value, std::memory_order_relaxed); }
+
+    int64 GetValue() const;
+
+    std::string const& GetCategory() const { return _category; }
+    std::vector<MetricTag> const& GetTags() const { return _tags; }
+
+private:
+    friend class Metric;
+
+    struct alignas(64) Shard
+    {
+        std::atomic<int64> Value = 0;
+    };
+
+    std::string _category;
+    std::vector<MetricTag> _tags;
+    std::array<Shard, MetricHistogram::SHARD_COUNT> _shards;
+    int64 _flushedValue = 0;
+};
+
 class AC_COMMON_API Metric
 {
 private:
@@ -75,10 +183,20 @@ private:
     std::string _databaseName;
     std::function<void()> _overallStatusLogger;
     std::string _realmName;
+    std::string _realmLabel;
     std::unordered_map<std::string, int64> _thresholds;
+    bool _sendToDatabase = false;
+    std::string _exportFile;
+
+    std::mutex _handlesLock;
+    std::deque<MetricHistogram> _histograms;
+    std::deque<MetricCounter> _counters;
 
     bool Connect();
     void SendBatch();
+    void AppendAggregatedData(std::ostream& batchedData, bool& firstLine, std::string const& timestamp);
+    void ApplyThreshold(MetricHistogram& histogram) const;
+    void WriteExportFile();
     void ScheduleSend();
     void ScheduleOverallStatusLog();
 
@@ -125,6 +243,10 @@ public:
 
     void LogEvent(std::string const& category, std::string const& title, std::string const& description);
 
+    /// Handles live until shutdown. Register them once and keep them, looking them up on every sample defeats their purpose.
+    MetricHistogram& GetHistogram(std::string const& category, std::vector<MetricTag> tags = {});
+    MetricCounter& GetCounter(std::string const& category, std::vector<MetricTag> tags = {});
+
     void Unload();
     bool IsEnabled() const { return _enabled; }
 };
@@ -171,6 +293,9 @@ MetricStopWatch<LoggerType> MakeMetricStopWatch(LoggerType&& loggerFunc)
 #define METRIC_DETAILED_EVENT(category, title, description) ((void)0)
 #define METRIC_DETAILED_TIMER(category, ...) ((void)0)
 #define METRIC_DETAILED_NO_THRESHOLD_TIMER(category, ...) ((void)0)
+#define METRIC_HISTOGRAM_TIMER(category, ...) ((void)0)
+#define METRIC_HISTOGRAM_TIMER_FOR(histogram) ((void)0)
+#define METRIC_COUNTER(category, value, ...) ((void)0)
 #else
 #if AC_PLATFORM != AC_PLATFORM_WINDOWS
 #define METRIC_EVENT(category, title, description)                  \
@@ -183,6 +308,14 @@ MetricStopWatch<LoggerType> MakeMetricStopWatch(LoggerType&& loggerFunc)
             if (sMetric->IsEnabled())                                  \
                 sMetric->LogValue(category, value, { __VA_ARGS__ });   \
         } while (0)
+#define METRIC_COUNTER(category, value, ...)                                                               \
+        do {                                                                                                \
+            if (sMetric->IsEnabled())                                                                       \
+            {                                                                                               \
+                static MetricCounter& __ac_metric_counter = sMetric->GetCounter(category, { __VA_ARGS__ }); \
+                __ac_metric_counter.Add(int64(value));                                                      \
+            }                                                                                               \
+        } while (0)
 #else
 #define METRIC_EVENT(category, title, description)                  \
         __pragma(warning(push))                                        \
@@ -200,12 +333,35 @@ MetricStopWatch<LoggerType> MakeMetricStopWatch(LoggerType&& loggerFunc)
                 sMetric->LogValue(category, value, { __VA_ARGS__ });   \
         } while (0)                                                    \
         __pragma(warning(pop))
+#define METRIC_COUNTER(category, value, ...)                                                               \
+        __pragma(warning(push))                                                                             \
+        __pragma(warning(disable:4127))                                                                     \
+        do {                                                                                                \
+            if (sMetric->IsEnabled())                                                                       \
+            {                                                                                               \
+                static MetricCounter& __ac_metric_counter = sMetric->GetCounter(category, { __VA_ARGS__ }); \
+                __ac_metric_counter.Add(int64(value));                                                      \
+            }                                                                                               \
+        } while (0)                                                                                         \
+        __pragma(warning(pop))
 #endif
 #define METRIC_TIMER(category, ...)                                                                           \
         MetricStopWatch METRIC_UNIQUE_NAME(__ac_metric_stop_watch) = MakeMetricStopWatch([&](TimePoint start) \
         {                                                                                                        \
             sMetric->LogValue(category, std::chrono::steady_clock::now() - start, { __VA_ARGS__ });              \
         });
+// Tags of a histogram timer are evaluated once per call site, use METRIC_HISTOGRAM_TIMER_FOR when they change between calls
+#define METRIC_HISTOGRAM_TIMER(category, ...)                                                                 \
+        MetricStopWatch METRIC_UNIQUE_NAME(__ac_metric_stop_watch) = MakeMetricStopWatch([&](TimePoint start) \
+        {                                                                                                        \
+            static MetricHistogram& __ac_metric_histogram = sMetric->GetHistogram(category, { __VA_ARGS__ });    \
+            __ac_metric_histogram.Record(std::chrono::steady_clock::now() - start);                              \
+        });
+#define METRIC_HISTOGRAM_TIMER_FOR(histogram)                                                                 \
+        MetricStopWatch METRIC_UNIQUE_NAME(__ac_metric_stop_watch) = MakeMetricStopWatch([&](TimePoint start) \
+        {                                                                                                        \
+            (histogram).Record(std::chrono::steady_clock::now() - start);                                        \
+        });
 #if defined WITH_DETAILED_METRICS
 #define METRIC_DETAILED_TIMER(category, ...)                                                                  \
         MetricStopWatch METRIC_UNIQUE_NAME(__ac_metric_stop_watch) = MakeMetricStopWatch([&](TimePoint start) \
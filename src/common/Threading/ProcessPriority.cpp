@@ -21,6 +21,7 @@
 #include <Windows.h>
 #elif defined(__linux__)
 #include "Log.h"
+#include <pthread.h>
 #include <sched.h>
 #include <sys/resource.h>
 #define PROCESS_HIGH_PRIORITY -15 // [-20, 19], default is 0
@@ -113,3 +114,30 @@ void SetProcessPriority(std::string const& logChannel, uint32 affinity, bool hig
     (void)highPriority;
 #endif
 }
+
+void SetThreadAffinity(std::string const& logChannel, uint32 processor)
+{
+#ifdef _WIN32 // Windows
+
+    if (processor >= sizeof(DWORD_PTR) * 8 || !SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << processor))
+    {
+        LOG_ERROR(logChannel, "Can't bind thread to processor {}", processor);
+    }
+
+#elif defined(__linux__) // Linux
+
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    CPU_SET(processor, &mask);
+
+    if (int error = pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask))
+    {
+        LOG_ERROR(logChannel, "Can't bind thread to processor {}, error: {}", processor, strerror(error));
+    }
+
+#else
+    // Suppresses unused argument warning for all other platforms
+    (void)logChannel;
+    (void)processor;
+#endif
+}
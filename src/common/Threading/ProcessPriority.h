@@ -26,4 +26,7 @@
 
 void AC_COMMON_API SetProcessPriority(std::string const& logChannel, uint32 affinity, bool highPriority);
 
+/// Pins the calling thread to a single processor
+void AC_COMMON_API SetThreadAffinity(std::string const& logChannel, uint32 processor);
+
 #endif
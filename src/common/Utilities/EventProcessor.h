@@ -112,6 +112,7 @@ class EventProcessor
         template<typename T>
         is_lambda_event<T> AddEventAtOffset(T&& event, Milliseconds offset, Milliseconds offset2) { AddEventAtOffset(new LambdaBasicEvent<T>(std::move(event)), offset, offset2); }
         void ModifyEventTime(BasicEvent* event, Milliseconds newTime);
+        [[nodiscard]] bool HasEvents() const { return !m_events.empty(); }
         [[nodiscard]] uint64 CalculateTime(uint64 t_offset) const;
 
         //calculates next queue tick time
@@ -0,0 +1,99 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectPool.h"
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace
+{
+    struct PoolTotals
+    {
+        char const* Name = nullptr;
+        std::vector<Acore::ObjectPoolCounters const*> Threads;
+
+        // counters of threads that already exited
+        uint64 RetiredAllocations = 0;
+        uint64 RetiredReused = 0;
+        uint64 RetiredReleased = 0;
+    };
+
+    std::mutex& GetRegistryLock()
+    {
+        static std::mutex lock;
+        return lock;
+    }
+
+    std::vector<PoolTotals>& GetPools()
+    {
+        static std::vector<PoolTotals> pools;
+        return pools;
+    }
+
+    PoolTotals& GetPool(char const* name)
+    {
+        std::vector<PoolTotals>& pools = GetPools();
+        auto itr = std::find_if(pools.begin(), pools.end(), [name](PoolTotals const& pool) { return std::strcmp(pool.Name, name) == 0; });
+        if (itr != pools.end())
+            return *itr;
+
+        PoolTotals& pool = pools.emplace_back();
+        pool.Name = name;
+        return pool;
+    }
+}
+
+void Acore::ObjectPoolRegistry::Register(char const* name, ObjectPoolCounters const* counters)
+{
+    std::lock_guard<std::mutex> lock(GetRegistryLock());
+    GetPool(name).Threads.push_back(counters);
+}
+
+void Acore::ObjectPoolRegistry::Unregister(char const* name, ObjectPoolCounters const* counters)
+{
+    std::lock_guard<std::mutex> lock(GetRegistryLock());
+    PoolTotals& pool = GetPool(name);
+    auto itr = std::find(pool.Threads.begin(), pool.Threads.end(), counters);
+    if (itr == pool.Threads.end())
+        return;
+
+    pool.RetiredAllocations += counters->Allocations.load(std::memory_order_relaxed);
+    pool.RetiredReused += counters->Reused.load(std::memory_order_relaxed);
+    pool.RetiredReleased += counters->Released.load(std::memory_order_relaxed);
+    pool.Threads.erase(itr);
+}
+
+void Acore::ObjectPoolRegistry::Visit(Visitor const& visitor)
+{
+    std::lock_guard<std::mutex> lock(GetRegistryLock());
+    for (PoolTotals const& pool : GetPools())
+    {
+        uint64 allocations = pool.RetiredAllocations;
+        uint64 reused = pool.RetiredReused;
+        uint64 released = pool.RetiredReleased;
+        for (ObjectPoolCounters const* counters : pool.Threads)
+        {
+            allocations += counters->Allocations.load(std::memory_order_relaxed);
+            reused += counters->Reused.load(std::memory_order_relaxed);
+            released += counters->Released.load(std::memory_order_relaxed);
+        }
+
+        // objects may be released by a thread whose counters were not sampled yet
+        visitor(pool.Name, allocations, reused, allocations > released ? allocations - released : 0);
+    }
+}
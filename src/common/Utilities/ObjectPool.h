@@ -0,0 +1,162 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_OBJECT_POOL_H
+#define ACORE_OBJECT_POOL_H
+
+#include "Define.h"
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <vector>
+
+namespace Acore
+{
+    /// Allocation counters of one thread for one pooled type.
+    /// Only the owning thread writes them, so the metric reader never contends with the allocating thread.
+    struct ObjectPoolCounters
+    {
+        std::atomic<uint64> Allocations{0};
+        std::atomic<uint64> Reused{0};
+        std::atomic<uint64> Released{0};
+
+        static void Increment(std::atomic<uint64>& counter)
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+    };
+
+    class AC_COMMON_API ObjectPoolRegistry
+    {
+    public:
+        using Visitor = std::function<void(char const* /*name*/, uint64 /*allocations*/, uint64 /*reused*/, uint64 /*inUse*/)>;
+
+        static void Register(char const* name, ObjectPoolCounters const* counters);
+        static void Unregister(char const* name, ObjectPoolCounters const* counters);
+
+        /// Calls the visitor once per pooled type with the counters summed over all threads
+        static void Visit(Visitor const& visitor);
+    };
+
+    /**
+     * Per-thread free list of fixed size blocks for short-lived objects that are created and destroyed
+     * many times per tick on map threads (spells, their events, aura applications...).
+     *
+     * Each thread keeps the blocks it released for its own next allocations, so the hot path never takes
+     * a lock. A block released on another thread than the one that allocated it simply joins the free
+     * list of the releasing thread. Compiling with ACORE_NO_OBJECT_POOLS (WITHOUT_OBJECT_POOLS or TSAN builds)
+     * routes everything back to the global operator new/delete.
+     */
+    template<class T, std::size_t MaxCachedBlocks = 1024>
+    class ObjectPool
+    {
+        struct ThreadCache
+        {
+            explicit ThreadCache(char const* name) : Name(name)
+            {
+                FreeList.reserve(MaxCachedBlocks);
+                ObjectPoolRegistry::Register(Name, &Counters);
+            }
+
+            ~ThreadCache()
+            {
+                Destroyed() = true;
+                ObjectPoolRegistry::Unregister(Name, &Counters);
+                for (void* block : FreeList)
+                    ::operator delete(block);
+            }
+
+            char const* Name;
+            std::vector<void*> FreeList;
+            ObjectPoolCounters Counters;
+        };
+
+        // trivially destructible, stays readable after the thread cache itself is gone during thread shutdown
+        static bool& Destroyed()
+        {
+            static thread_local bool destroyed = false;
+            return destroyed;
+        }
+
+        static ThreadCache* GetThreadCache(char const* name)
+        {
+            if (Destroyed())
+                return nullptr;
+
+            static thread_local ThreadCache cache(name);
+            return &cache;
+        }
+
+    public:
+        static void* Allocate(std::size_t size, char const* name)
+        {
+#ifndef ACORE_NO_OBJECT_POOLS
+            // derived classes inherit the class-specific operator new, they are not pooled
+            if (size == sizeof(T))
+            {
+                if (ThreadCache* cache = GetThreadCache(name))
+                {
+                    ObjectPoolCounters::Increment(cache->Counters.Allocations);
+                    if (!cache->FreeList.empty())
+                    {
+                        ObjectPoolCounters::Increment(cache->Counters.Reused);
+                        void* block = cache->FreeList.back();
+                        cache->FreeList.pop_back();
+                        return block;
+                    }
+                }
+            }
+#else
+            (void)name;
+#endif
+            return ::operator new(size);
+        }
+
+        static void Deallocate(void* block, std::size_t size, char const* name)
+        {
+            if (!block)
+                return;
+
+#ifndef ACORE_NO_OBJECT_POOLS
+            if (size == sizeof(T))
+            {
+                if (ThreadCache* cache = GetThreadCache(name))
+                {
+                    ObjectPoolCounters::Increment(cache->Counters.Released);
+                    if (cache->FreeList.size() < MaxCachedBlocks)
+                    {
+                        cache->FreeList.push_back(block);
+                        return;
+                    }
+                }
+            }
+#else
+            (void)size;
+            (void)name;
+#endif
+            ::operator delete(block);
+        }
+    };
+}
+
+/// Routes heap allocations of the class through Acore::ObjectPool, place inside the class definition
+#define ACORE_POOLED_ALLOCATION(T)                                                              \
+    static void* operator new(std::size_t size) { return Acore::ObjectPool<T>::Allocate(size, #T); } \
+    static void operator delete(void* block, std::size_t size) { Acore::ObjectPool<T>::Deallocate(block, size, #T); }
+
+#endif // ACORE_OBJECT_POOL_H
@@ -27,6 +27,7 @@
 #include "AuthSocketMgr.h"
 #include "Banner.h"
 #include "Config.h"
+#include "CryptoWorkerPool.h"
 #include "DatabaseEnv.h"
 #include "DatabaseLoader.h"
 #include "DeadlineTimer.h"
@@ -34,6 +35,7 @@
 #include "IPLocation.h"
 #include "IoContext.h"
 #include "Log.h"
+#include "Metric.h"
 #include "MySQLThreading.h"
 #include "OpenSSLCrypto.h"
 #include "ProcessPriority.h"
@@ -159,6 +161,19 @@ int main(int argc, char** argv)
 
     std::string bindIp = sConfigMgr->GetOption<std::string>("BindIP", "0.0.0.0");
 
+    // SRP6 exponentiations of logon challenges and proofs run there instead of on the network thread
+    sCryptoWorkerPool->Start(sConfigMgr->GetOption<uint32>("CryptoWorkerPool.Threads", 2), sConfigMgr->GetOption<uint32>("CryptoWorkerPool.MaxQueuedTasks", 1000));
+
+    std::shared_ptr<void> sCryptoWorkerPoolHandle(nullptr, [](void*) { sCryptoWorkerPool->Stop(); });
+
+    sMetric->Initialize("authserver", *ioContext, []()
+    {
+        METRIC_VALUE("crypto_queue_depth", uint64(sCryptoWorkerPool->GetQueueDepth()));
+        METRIC_VALUE("crypto_inline_tasks", uint64(sCryptoWorkerPool->TakeInlineTaskCount()));
+    });
+
+    std::shared_ptr<void> sMetricHandle(nullptr, [](void*) { sMetric->Unload(); });
+
     if (!sAuthSocketMgr.StartNetwork(*ioContext, bindIp, port))
     {
         LOG_ERROR("server.authserver", "Failed to initialize network");
@@ -22,6 +22,7 @@
 #include "CryptoGenerics.h"
 #include "CryptoHash.h"
 #include "CryptoRandom.h"
+#include "CryptoWorkerPool.h"
 #include "DatabaseEnv.h"
 #include "Errors.h"
 #include "IPLocation.h"
@@ -185,6 +186,7 @@ bool AuthSession::Update()
         return false;
 
     _queryProcessor.ProcessReadyCallbacks();
+    _cryptoProcessor.ProcessReadyCallbacks();
 
     return true;
 }
@@ -408,9 +410,22 @@ void AuthSession::LogonChallengeCallback(PreparedQueryResult result)
         }
     }
 
-    _srp6.emplace(_accountInfo.Login,
-        fields[12].Get<Binary, Acore::Crypto::SRP6::SALT_LENGTH>(),
-        fields[13].Get<Binary, Acore::Crypto::SRP6::VERIFIER_LENGTH>());
+    Acore::Crypto::SRP6::Salt salt = fields[12].Get<Binary, Acore::Crypto::SRP6::SALT_LENGTH>();
+    Acore::Crypto::SRP6::Verifier verifier = fields[13].Get<Binary, Acore::Crypto::SRP6::VERIFIER_LENGTH>();
+
+    // computing B is a modular exponentiation, keep it off the network thread
+    std::shared_ptr<AuthSession> self = shared_from_this();
+    _cryptoProcessor.AddCallback(sCryptoWorkerPool->Submit([self, salt, verifier]()
+    {
+        self->_srp6.emplace(self->_accountInfo.Login, salt, verifier);
+    }, std::bind(&AuthSession::LogonChallengeSRP6Callback, this, securityFlags)));
+}
+
+void AuthSession::LogonChallengeSRP6Callback(uint8 securityFlags)
+{
+    ByteBuffer pkt;
+    pkt << uint8(AUTH_LOGON_CHALLENGE);
+    pkt << uint8(0x00);
 
     // Fill the response packet with the result
     if (AuthHelper::IsAcceptedClientBuild(_build))
@@ -445,7 +460,7 @@ void AuthSession::LogonChallengeCallback(PreparedQueryResult result)
             pkt << uint8(1);
 
         LOG_DEBUG("server.authserver", "'{}:{}' [AuthChallenge] account {} is using '{}' locale ({})",
-            ipAddress, port, _accountInfo.Login, _localizationName, GetLocaleByName(_localizationName));
+            GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login, _localizationName, GetLocaleByName(_localizationName));
 
         _status = STATUS_LOGON_PROOF;
     }
@@ -461,8 +476,8 @@ bool AuthSession::HandleLogonProof()
     LOG_DEBUG("server.authserver", "Entering _HandleLogonProof");
     _status = STATUS_CLOSED;
 
-    // Read the packet
-    sAuthLogonProof_C* logonProof = reinterpret_cast<sAuthLogonProof_C*>(GetReadBuffer().GetReadPointer());
+    // Read the packet, the read buffer moves on before the verification below finishes
+    sAuthLogonProof_C logonProof = *reinterpret_cast<sAuthLogonProof_C*>(GetReadBuffer().GetReadPointer());
 
     // If the client has no valid version
     if (_expversion == NO_VALID_EXP_FLAG)
@@ -472,21 +487,42 @@ bool AuthSession::HandleLogonProof()
         return false;
     }
 
+    Optional<uint32> incomingToken;
+    if ((logonProof.securityFlags & 0x04) && _totpSecret)
+    {
+        uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
+        std::string token(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
+        GetReadBuffer().ReadCompleted(sizeof(size) + size);
+
+        incomingToken = Acore::StringTo<uint32>(token);
+    }
+
+    // verifying the client proof takes two modular exponentiations, keep them off the network thread
+    std::shared_ptr<AuthSession> self = shared_from_this();
+    std::shared_ptr<Optional<SessionKey>> sessionKey = std::make_shared<Optional<SessionKey>>();
+    _cryptoProcessor.AddCallback(sCryptoWorkerPool->Submit([self, sessionKey, A = logonProof.A, clientM = logonProof.clientM]()
+    {
+        *sessionKey = self->_srp6->VerifyChallengeResponse(A, clientM);
+    }, [this, sessionKey, logonProof, incomingToken]()
+    {
+        LogonProofCallback(*sessionKey, logonProof, incomingToken);
+    }));
+
+    return true;
+}
+
+void AuthSession::LogonProofCallback(Optional<SessionKey> const& sessionKey, AUTH_LOGON_PROOF_C const& logonProof, Optional<uint32> incomingToken)
+{
     // Check if SRP6 results match (password is correct), else send an error
-    if (Optional<SessionKey> K = _srp6->VerifyChallengeResponse(logonProof->A, logonProof->clientM))
+    if (sessionKey)
     {
-        _sessionKey = *K;
+        _sessionKey = *sessionKey;
         // Check auth token
         bool tokenSuccess = false;
-        bool sentToken = (logonProof->securityFlags & 0x04);
+        bool sentToken = (logonProof.securityFlags & 0x04);
         if (sentToken && _totpSecret)
         {
-            uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
-            std::string token(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
-            GetReadBuffer().ReadCompleted(sizeof(size) + size);
-
-            uint32 incomingToken = *Acore::StringTo<uint32>(token);
-            tokenSuccess = Acore::Crypto::TOTP::ValidateToken(*_totpSecret, incomingToken);
+            tokenSuccess = incomingToken && Acore::Crypto::TOTP::ValidateToken(*_totpSecret, *incomingToken);
             memset(_totpSecret->data(), 0, _totpSecret->size());
         }
         else if (!sentToken && !_totpSecret)
@@ -499,16 +535,16 @@ bool AuthSession::HandleLogonProof()
             packet << uint8(WOW_FAIL_UNKNOWN_ACCOUNT);
             packet << uint16(0);    // LoginFlags, 1 has account message
             SendPacket(packet);
-            return true;
+            return;
         }
 
-        if (!VerifyVersion(logonProof->A.data(), logonProof->A.size(), logonProof->crc_hash, false))
+        if (!VerifyVersion(logonProof.A.data(), logonProof.A.size(), logonProof.crc_hash, false))
         {
             ByteBuffer packet;
             packet << uint8(AUTH_LOGON_PROOF);
             packet << uint8(WOW_FAIL_VERSION_INVALID);
             SendPacket(packet);
-            return true;
+            return;
         }
 
         LOG_DEBUG("server.authserver", "'{}:{}' User '{}' successfully authenticated", GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login);
@@ -526,7 +562,7 @@ bool AuthSession::HandleLogonProof()
         LoginDatabase.DirectExecute(stmt);
 
         // Finish SRP6 and send the final result to the client
-        Acore::Crypto::SHA1::Digest M2 = Acore::Crypto::SRP6::GetSessionVerifier(logonProof->A, logonProof->clientM, _sessionKey);
+        Acore::Crypto::SHA1::Digest M2 = Acore::Crypto::SRP6::GetSessionVerifier(logonProof.A, logonProof.clientM, _sessionKey);
 
         ByteBuffer packet;
         if (_expversion & POST_BC_EXP_FLAG)                 // 2.x and 3.x clients
@@ -616,8 +652,6 @@ bool AuthSession::HandleLogonProof()
             }
         }
     }
-
-    return true;
 }
 
 bool AuthSession::HandleReconnectChallenge()
@@ -23,6 +23,7 @@
 #include "ByteBuffer.h"
 #include "Common.h"
 #include "CryptoHash.h"
+#include "CryptoWorkerPool.h"
 #include "Optional.h"
 #include "QueryResult.h"
 #include "SRP6.h"
@@ -34,6 +35,7 @@ using boost::asio::ip::tcp;
 
 class Field;
 struct AuthHandler;
+struct AUTH_LOGON_PROOF_C;
 
 enum AuthStatus
 {
@@ -86,6 +88,8 @@ private:
 
     void CheckIpCallback(PreparedQueryResult result);
     void LogonChallengeCallback(PreparedQueryResult result);
+    void LogonChallengeSRP6Callback(uint8 securityFlags);
+    void LogonProofCallback(Optional<SessionKey> const& sessionKey, AUTH_LOGON_PROOF_C const& logonProof, Optional<uint32> incomingToken);
     void ReconnectChallengeCallback(PreparedQueryResult result);
     void RealmListCallback(PreparedQueryResult result);
 
@@ -105,6 +109,7 @@ private:
     uint8 _expversion;
 
     QueryCallbackProcessor _queryProcessor;
+    AsyncCallbackProcessor<Acore::Crypto::CryptoTaskCallback> _cryptoProcessor;
 };
 
 #pragma pack(push, 1)
@@ -37,7 +37,7 @@ public:
         if (!BaseSocketMgr::StartNetwork(ioContext, bindIp, port, threadCount))
             return false;
 
-        _acceptor->AsyncAcceptWithCallback<&AuthSocketMgr::OnSocketAccept>();
+        StartAccepting<&AuthSocketMgr::OnSocketAccept>();
         return true;
     }
 
@@ -39,6 +39,7 @@
 #include "ModuleMgr.h"
 #include "ModulesScriptLoader.h"
 #include "MySQLThreading.h"
+#include "ObjectPool.h"
 #include "OpenSSLCrypto.h"
 #include "OutdoorPvPMgr.h"
 #include "ProcessPriority.h"
@@ -252,6 +253,21 @@ int main(int argc, char** argv)
         METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+        Acore::ObjectPoolRegistry::Visit([](char const* name, uint64 allocations, uint64 reused, uint64 inUse)
+        {
+            METRIC_VALUE("object_pool_allocations", allocations, METRIC_TAG("type", name));
+            METRIC_VALUE("object_pool_reused", reused, METRIC_TAG("type", name));
+            METRIC_VALUE("object_pool_in_use", inUse, METRIC_TAG("type", name));
+        });
+
+        uint64 writtenPackets, writeSyscalls, writtenBytes;
+        sWorldSocketMgr.TakeWriteStatistics(writtenPackets, writeSyscalls, writtenBytes);
+        METRIC_VALUE("network_write_syscalls", writeSyscalls);
+        if (writeSyscalls)
+        {
+            METRIC_VALUE("network_packets_per_syscall", double(writtenPackets) / writeSyscalls);
+            METRIC_VALUE("network_bytes_per_syscall", double(writtenBytes) / writeSyscalls);
+        }
         sScriptMgr->OnMetricLogging();
     });
 
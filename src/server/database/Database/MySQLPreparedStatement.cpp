@@ -46,10 +46,6 @@ MySQLPreparedStatement::MySQLPreparedStatement(MySQLStmt* stmt, std::string_view
     m_paramsSet.assign(m_paramCount, false);
     m_bind = new MySQLBind[m_paramCount];
     memset(m_bind, 0, sizeof(MySQLBind) * m_paramCount);
-
-    /// "If set to 1, causes mysql_stmt_store_result() to update the metadata MYSQL_FIELD->max_length value."
-    MySQLBool bool_tmp = MySQLBool(1);
-    mysql_stmt_attr_set(stmt, STMT_ATTR_UPDATE_MAX_LENGTH, &bool_tmp);
 }
 
 MySQLPreparedStatement::~MySQLPreparedStatement()
@@ -32,3 +32,13 @@ uint32 MySQL::GetLibraryVersion()
 {
     return MYSQL_VERSION_ID;
 }
+
+void MySQL::Thread_Init()
+{
+    mysql_thread_init();
+}
+
+void MySQL::Thread_End()
+{
+    mysql_thread_end();
+}
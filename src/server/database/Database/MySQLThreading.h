@@ -25,6 +25,10 @@ namespace MySQL
     AC_DATABASE_API void Library_Init();
     AC_DATABASE_API void Library_End();
     AC_DATABASE_API uint32 GetLibraryVersion();
+
+    /// Sets up and releases the client library state of threads that use connections but were not started by the database workers
+    AC_DATABASE_API void Thread_Init();
+    AC_DATABASE_API void Thread_End();
 }
 
 #endif
@@ -21,6 +21,8 @@
 #include "Log.h"
 #include "MySQLHacks.h"
 #include "MySQLWorkaround.h"
+#include "QuerySnapshot.h"
+#include <cstring>
 
 namespace
 {
@@ -152,6 +154,25 @@ namespace
         }
     }
 
+    // Values of these types are stored with their own length instead of a fixed slot
+    bool IsVariableSizeType(enum_field_types type)
+    {
+        switch (type)
+        {
+            case MYSQL_TYPE_TINY_BLOB:
+            case MYSQL_TYPE_MEDIUM_BLOB:
+            case MYSQL_TYPE_LONG_BLOB:
+            case MYSQL_TYPE_BLOB:
+            case MYSQL_TYPE_STRING:
+            case MYSQL_TYPE_VAR_STRING:
+            case MYSQL_TYPE_DECIMAL:
+            case MYSQL_TYPE_NEWDECIMAL:
+                return true;
+            default:
+                return false;
+        }
+    }
+
     void InitializeDatabaseFieldMetadata(QueryResultFieldMetadata* meta, MySQLField const* field, uint32 fieldIndex)
     {
         meta->TableName = field->org_table;
@@ -168,7 +189,9 @@ ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, u
     _rowCount(rowCount),
     _fieldCount(fieldCount),
     _result(result),
-    _fields(fields)
+    _fields(fields),
+    _snapshotRows(nullptr),
+    _snapshotRowsEnd(nullptr)
 {
     _fieldMetadata.resize(_fieldCount);
     _currentRow = new Field[_fieldCount];
@@ -180,6 +203,22 @@ ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, u
     }
 }
 
+ResultSet::ResultSet(std::vector<QueryResultFieldMetadata> fieldMetadata, char const* rows, char const* rowsEnd, uint64 rowCount, std::shared_ptr<void const> rowsOwner) :
+    _fieldMetadata(std::move(fieldMetadata)),
+    _rowCount(rowCount),
+    _fieldCount(uint32(_fieldMetadata.size())),
+    _result(nullptr),
+    _fields(nullptr),
+    _snapshotRows(rows),
+    _snapshotRowsEnd(rowsEnd),
+    _snapshotOwner(std::move(rowsOwner))
+{
+    _currentRow = new Field[_fieldCount];
+
+    for (uint32 i = 0; i < _fieldCount; i++)
+        _currentRow[i].SetMetadata(&_fieldMetadata[i]);
+}
+
 ResultSet::~ResultSet()
 {
     CleanUp();
@@ -189,6 +228,9 @@ bool ResultSet::NextRow()
 {
     MYSQL_ROW row;
 
+    if (_snapshotOwner)
+        return NextSnapshotRow();
+
     if (!_result)
         return false;
 
@@ -213,10 +255,46 @@ bool ResultSet::NextRow()
     return true;
 }
 
+bool ResultSet::NextSnapshotRow()
+{
+    if (_snapshotRows == _snapshotRowsEnd)
+    {
+        CleanUp();
+        return false;
+    }
+
+    // Values point straight into the snapshot, the layout was validated by QuerySnapshot before handing out the rows
+    for (uint32 i = 0; i < _fieldCount; i++)
+    {
+        uint32 length;
+        ASSERT(_snapshotRowsEnd - _snapshotRows >= std::ptrdiff_t(sizeof(length)));
+        std::memcpy(&length, _snapshotRows, sizeof(length));
+        _snapshotRows += sizeof(length);
+
+        if (length == QuerySnapshot::NULL_LENGTH)
+        {
+            _currentRow[i].SetStructuredValue(nullptr, 0);
+            continue;
+        }
+
+        ASSERT(_snapshotRowsEnd - _snapshotRows > std::ptrdiff_t(length));
+        _currentRow[i].SetStructuredValue(_snapshotRows, length);
+        _snapshotRows += length + 1;
+    }
+
+    return true;
+}
+
 std::string ResultSet::GetFieldName(uint32 index) const
 {
     ASSERT(index < _fieldCount);
-    return _fields[index].name;
+    return _fieldMetadata[index].Alias;
+}
+
+QueryResultFieldMetadata const& ResultSet::GetFieldMetadata(uint32 index) const
+{
+    ASSERT(index < _fieldCount);
+    return _fieldMetadata[index];
 }
 
 void ResultSet::CleanUp()
@@ -232,6 +310,9 @@ void ResultSet::CleanUp()
         mysql_free_result(_result);
         _result = nullptr;
     }
+
+    _snapshotOwner.reset();
+    _snapshotRows = _snapshotRowsEnd = nullptr;
 }
 
 Field const& ResultSet::operator[](std::size_t index) const
@@ -249,7 +330,6 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
     m_rowCount(rowCount),
     m_rowPosition(0),
     m_fieldCount(fieldCount),
-    m_rBind(nullptr),
     m_stmt(stmt),
     m_metadataResult(result)
 {
@@ -262,119 +342,80 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
         delete[] m_stmt->bind->is_null;
     }
 
-    m_rBind = new MySQLBind[m_fieldCount];
+    std::vector<MySQLBind> bind(m_fieldCount);
 
     //- for future readers wondering where this is freed - mysql_stmt_bind_result moves pointers to these
-    // from m_rBind to m_stmt->bind and it is later freed by the `if (m_stmt->bind_result_done)` block just above here
+    // from bind to m_stmt->bind and it is later freed by the `if (m_stmt->bind_result_done)` block just above here
     // MYSQL_STMT lifetime is equal to connection lifetime
     MySQLBool* m_isNull = new MySQLBool[m_fieldCount];
     unsigned long* m_length = new unsigned long[m_fieldCount];
 
     memset(m_isNull, 0, sizeof(MySQLBool) * m_fieldCount);
-    memset(m_rBind, 0, sizeof(MySQLBind) * m_fieldCount);
+    memset(bind.data(), 0, sizeof(MySQLBind) * m_fieldCount);
     memset(m_length, 0, sizeof(unsigned long) * m_fieldCount);
 
-    //- This is where we store the (entire) resultset
-    if (mysql_stmt_store_result(m_stmt))
-    {
-        LOG_WARN("sql.sql", "{}:mysql_stmt_store_result, cannot bind result from MySQL server. Error: {}", __FUNCTION__, mysql_stmt_error(m_stmt));
-        delete[] m_rBind;
-        delete[] m_isNull;
-        delete[] m_length;
-        return;
-    }
-
-    m_rowCount = mysql_stmt_num_rows(m_stmt);
-
-    //- This is where we prepare the buffer based on metadata
+    //- This is where we prepare the columns based on metadata
     MySQLField* field = reinterpret_cast<MySQLField*>(mysql_fetch_fields(m_metadataResult));
     m_fieldMetadata.resize(m_fieldCount);
-    std::size_t rowSize = 0;
+    m_columns.resize(m_fieldCount);
+    std::size_t fixedRowSize = 0;
 
     for (uint32 i = 0; i < m_fieldCount; ++i)
     {
-        uint32 size = SizeForType(&field[i]);
-        rowSize += size;
-
         InitializeDatabaseFieldMetadata(&m_fieldMetadata[i], &field[i], i);
 
-        m_rBind[i].buffer_type = field[i].type;
-        m_rBind[i].buffer_length = size;
-        m_rBind[i].length = &m_length[i];
-        m_rBind[i].is_null = &m_isNull[i];
-        m_rBind[i].error = nullptr;
-        m_rBind[i].is_unsigned = field[i].flags & UNSIGNED_FLAG;
+        bind[i].buffer_type = field[i].type;
+        bind[i].length = &m_length[i];
+        bind[i].is_null = &m_isNull[i];
+        bind[i].error = nullptr;
+        bind[i].is_unsigned = field[i].flags & UNSIGNED_FLAG;
+
+        // variable size values are bound without a buffer, FetchRows reads them with mysql_stmt_fetch_column once their length is known
+        if (IsVariableSizeType(field[i].type))
+        {
+            m_columns[i].Offsets.push_back(0);
+            continue;
+        }
+
+        m_columns[i].ValueSize = SizeForType(&field[i]);
+        bind[i].buffer_length = m_columns[i].ValueSize;
+        fixedRowSize += m_columns[i].ValueSize;
     }
 
-    char* dataBuffer = new char[rowSize * m_rowCount];
+    std::vector<char> fixedBuffer(fixedRowSize);
     for (uint32 i = 0, offset = 0; i < m_fieldCount; ++i)
     {
-        m_rBind[i].buffer = dataBuffer + offset;
-        offset += m_rBind[i].buffer_length;
+        if (!m_columns[i].ValueSize)
+            continue;
+
+        bind[i].buffer = fixedBuffer.data() + offset;
+        offset += m_columns[i].ValueSize;
     }
 
-    //- This is where we bind the bind the buffer to the statement
-    if (mysql_stmt_bind_result(m_stmt, m_rBind))
+    //- This is where we bind the buffers to the statement
+    if (mysql_stmt_bind_result(m_stmt, bind.data()))
     {
         LOG_WARN("sql.sql", "{}:mysql_stmt_bind_result, cannot bind result from MySQL server. Error: {}", __FUNCTION__, mysql_stmt_error(m_stmt));
         mysql_stmt_free_result(m_stmt);
         CleanUp();
         delete[] m_isNull;
         delete[] m_length;
+        m_rowCount = 0;
         return;
     }
 
-    m_rows.resize(uint32(m_rowCount) * m_fieldCount);
-
-    while (_NextRow())
-    {
-        for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
-        {
-            m_rows[uint32(m_rowPosition) * m_fieldCount + fIndex].SetMetadata(&m_fieldMetadata[fIndex]);
-
-            unsigned long buffer_length = m_rBind[fIndex].buffer_length;
-            unsigned long fetched_length = *m_rBind[fIndex].length;
-            if (!*m_rBind[fIndex].is_null)
-            {
-                void* buffer = m_stmt->bind[fIndex].buffer;
-                switch (m_rBind[fIndex].buffer_type)
-                {
-                case MYSQL_TYPE_TINY_BLOB:
-                case MYSQL_TYPE_MEDIUM_BLOB:
-                case MYSQL_TYPE_LONG_BLOB:
-                case MYSQL_TYPE_BLOB:
-                case MYSQL_TYPE_STRING:
-                case MYSQL_TYPE_VAR_STRING:
-                    // warning - the string will not be null-terminated if there is no space for it in the buffer
-                    // when mysql_stmt_fetch returned MYSQL_DATA_TRUNCATED
-                    // we cannot blindly null-terminate the data either as it may be retrieved as binary blob and not specifically a string
-                    // in this case using Field::GetCString will result in garbage
-                    /// @todo: remove Field::GetCString and use std::string_view in C++17
-                    if (fetched_length < buffer_length)
-                        *((char*)buffer + fetched_length) = '\0';
-                    break;
-                default:
-                    break;
-                }
+    // a fetch error discards every row, the query then has no result like any other failed query
+    FetchRows(bind.data());
 
-                m_rows[uint32(m_rowPosition) * m_fieldCount + fIndex].SetByteValue((char const*)buffer, fetched_length);
-
-                // move buffer pointer to next part
-                m_stmt->bind[fIndex].buffer = (char*)buffer + rowSize;
-            }
-            else
-            {
-                m_rows[uint32(m_rowPosition) * m_fieldCount + fIndex].SetByteValue(nullptr, *m_rBind[fIndex].length);
-            }
-        }
-
-        m_rowPosition++;
-    }
+    /// All data is in the columns, let go of mysql c api structures
+    mysql_stmt_free_result(m_stmt);
 
-    m_rowPosition = 0;
+    m_currentRow.resize(m_fieldCount);
+    for (uint32 i = 0; i < m_fieldCount; ++i)
+        m_currentRow[i].SetMetadata(&m_fieldMetadata[i]);
 
-    /// All data is buffered, let go of mysql c api structures
-    mysql_stmt_free_result(m_stmt);
+    if (m_rowCount)
+        SetCurrentRow();
 }
 
 PreparedResultSet::~PreparedResultSet()
@@ -384,48 +425,130 @@ PreparedResultSet::~PreparedResultSet()
 
 bool PreparedResultSet::NextRow()
 {
-    /// Only updates the m_rowPosition so upper level code knows in which element
-    /// of the rows vector to look
+    /// Only updates the m_rowPosition and points the current row fields to it
     if (++m_rowPosition >= m_rowCount)
         return false;
 
+    SetCurrentRow();
     return true;
 }
 
-bool PreparedResultSet::_NextRow()
+void PreparedResultSet::FetchRows(MySQLBind* bind)
 {
-    /// Only called in low-level code, namely the constructor
-    /// Will iterate over every row of data and buffer it
-    if (m_rowPosition >= m_rowCount)
-        return false;
+    /// Rows are read unbuffered, straight from the connection into the columns
+    m_rowCount = 0;
+
+    while (true)
+    {
+        int retval = mysql_stmt_fetch(m_stmt);
+        if (retval == MYSQL_NO_DATA)
+            break;
+
+        // variable size columns are bound without a buffer, they always report truncation
+        if (retval != 0 && retval != MYSQL_DATA_TRUNCATED)
+        {
+            LOG_ERROR("sql.sql", "{}:mysql_stmt_fetch, cannot fetch row {}. Error: {}", __FUNCTION__, m_rowCount, mysql_stmt_error(m_stmt));
+            DiscardRows();
+            return;
+        }
+
+        for (uint32 i = 0; i < m_fieldCount; ++i)
+        {
+            Column& column = m_columns[i];
+            bool isNull = *bind[i].is_null;
+            column.Nulls.push_back(isNull);
+
+            if (column.ValueSize)
+            {
+                char const* value = static_cast<char const*>(bind[i].buffer);
+                column.Data.insert(column.Data.end(), value, value + column.ValueSize);
+                continue;
+            }
 
-    int retval = mysql_stmt_fetch(m_stmt);
-    return retval == 0 || retval == MYSQL_DATA_TRUNCATED;
+            if (!isNull)
+            {
+                unsigned long length = *bind[i].length;
+                std::size_t offset = column.Data.size();
+                column.Data.resize(offset + length + 1);
+
+                if (length)
+                {
+                    unsigned long fetchedLength = 0;
+                    MySQLBind valueBind = bind[i];
+                    valueBind.buffer = column.Data.data() + offset;
+                    valueBind.buffer_length = length;
+                    valueBind.length = &fetchedLength;
+
+                    if (mysql_stmt_fetch_column(m_stmt, &valueBind, i, 0))
+                    {
+                        LOG_ERROR("sql.sql", "{}:mysql_stmt_fetch_column, cannot fetch field {} of row {}. Error: {}", __FUNCTION__, i, m_rowCount, mysql_stmt_error(m_stmt));
+                        DiscardRows();
+                        return;
+                    }
+                }
+
+                // strings stay null-terminated for Field::GetData, blobs are read with their length
+                column.Data.back() = '\0';
+            }
+
+            column.Offsets.push_back(uint32(column.Data.size()));
+        }
+
+        ++m_rowCount;
+    }
+}
+
+void PreparedResultSet::DiscardRows()
+{
+    // a part of a result must not look like all of it, callers see no rows like for any failed query
+    for (Column& column : m_columns)
+    {
+        column.Data.clear();
+        column.Nulls.clear();
+        if (!column.ValueSize)
+            column.Offsets.assign(1, 0);
+    }
+
+    m_rowCount = 0;
+}
+
+void PreparedResultSet::SetCurrentRow()
+{
+    for (uint32 i = 0; i < m_fieldCount; ++i)
+    {
+        Column const& column = m_columns[i];
+
+        if (column.Nulls[m_rowPosition])
+            m_currentRow[i].SetByteValue(nullptr, 0);
+        else if (column.ValueSize)
+            m_currentRow[i].SetByteValue(column.Data.data() + m_rowPosition * column.ValueSize, column.ValueSize);
+        else
+        {
+            uint32 offset = column.Offsets[m_rowPosition];
+            m_currentRow[i].SetByteValue(column.Data.data() + offset, column.Offsets[m_rowPosition + 1] - offset - 1);
+        }
+    }
 }
 
 Field* PreparedResultSet::Fetch() const
 {
     ASSERT(m_rowPosition < m_rowCount);
-    return const_cast<Field*>(&m_rows[uint32(m_rowPosition) * m_fieldCount]);
+    return const_cast<Field*>(m_currentRow.data());
 }
 
 Field const& PreparedResultSet::operator[](std::size_t index) const
 {
     ASSERT(m_rowPosition < m_rowCount);
     ASSERT(index < m_fieldCount);
-    return m_rows[uint32(m_rowPosition) * m_fieldCount + index];
+    return m_currentRow[index];
 }
 
 void PreparedResultSet::CleanUp()
 {
     if (m_metadataResult)
-        mysql_free_result(m_metadataResult);
-
-    if (m_rBind)
     {
-        delete[](char*)m_rBind->buffer;
-        delete[] m_rBind;
-        m_rBind = nullptr;
+        mysql_free_result(m_metadataResult);
+        m_metadataResult = nullptr;
     }
 }
 
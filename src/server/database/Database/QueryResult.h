@@ -49,12 +49,16 @@ class AC_DATABASE_API ResultSet
 {
 public:
     ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount);
+    /// Rows stored by QuerySnapshot: per field a uint32 length (QuerySnapshot::NULL_LENGTH for NULL) followed by the text value and a '\0'.
+    /// rowsOwner keeps the memory between rows and rowsEnd alive for the lifetime of the result.
+    ResultSet(std::vector<QueryResultFieldMetadata> fieldMetadata, char const* rows, char const* rowsEnd, uint64 rowCount, std::shared_ptr<void const> rowsOwner);
     ~ResultSet();
 
     bool NextRow();
     [[nodiscard]] uint64 GetRowCount() const { return _rowCount; }
     [[nodiscard]] uint32 GetFieldCount() const { return _fieldCount; }
     [[nodiscard]] std::string GetFieldName(uint32 index) const;
+    [[nodiscard]] QueryResultFieldMetadata const& GetFieldMetadata(uint32 index) const;
 
     [[nodiscard]] Field* Fetch() const { return _currentRow; }
     Field const& operator[](std::size_t index) const;
@@ -87,14 +91,29 @@ protected:
 private:
     void CleanUp();
     void AssertRows(std::size_t sizeRows);
+    bool NextSnapshotRow();
 
     MySQLResult* _result;
     MySQLField* _fields;
 
+    char const* _snapshotRows;
+    char const* _snapshotRowsEnd;
+    std::shared_ptr<void const> _snapshotOwner;
+
     ResultSet(ResultSet const& right) = delete;
     ResultSet& operator=(ResultSet const& right) = delete;
 };
 
+/**
+    @class PreparedResultSet
+
+    @brief Result of a prepared statement, stored column by column
+
+    Rows are fetched straight from the connection without mysql_stmt_store_result. Fixed size values
+    are packed into one array per column and strings/blobs/decimals are appended to a per column byte
+    arena, so a result costs its raw data plus one null bit per value. Fetch() and operator[] expose the
+    current row through a single Field array that NextRow() repoints, no per row or per field objects exist.
+*/
 class AC_DATABASE_API PreparedResultSet
 {
 public:
@@ -118,7 +137,7 @@ public:
         std::apply([this](Ts&... args)
         {
             uint8 index{ 0 };
-            ((args = m_rows[uint32(m_rowPosition) * m_fieldCount + index].Get<Ts>(), index++), ...);
+            ((args = m_currentRow[index].Get<Ts>(), index++), ...);
         }, theTuple);
 
         return theTuple;
@@ -128,19 +147,29 @@ public:
     static auto end()   { return ResultIterator<PreparedResultSet>(nullptr); }
 
 protected:
+    struct Column
+    {
+        uint32 ValueSize = 0;                   ///< Bytes per value in Data, 0 for variable size columns
+        std::vector<char> Data;                 ///< Packed fixed size values or all variable size values, each followed by a '\0'
+        std::vector<uint32> Offsets;            ///< Variable size columns only: start of every value in Data plus the end of the last one
+        std::vector<bool> Nulls;
+    };
+
     std::vector<QueryResultFieldMetadata> m_fieldMetadata;
-    std::vector<Field> m_rows;
+    std::vector<Column> m_columns;
+    std::vector<Field> m_currentRow;
     uint64 m_rowCount;
     uint64 m_rowPosition;
     uint32 m_fieldCount;
 
 private:
-    MySQLBind* m_rBind;
     MySQLStmt* m_stmt;
     MySQLResult* m_metadataResult;    ///< Field metadata, returned by mysql_stmt_result_metadata
 
     void CleanUp();
-    bool _NextRow();
+    void FetchRows(MySQLBind* bind);
+    void DiscardRows();
+    void SetCurrentRow();
 
     void AssertRows(std::size_t sizeRows);
 
@@ -0,0 +1,361 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "QuerySnapshot.h"
+#include "DatabaseEnv.h"
+#include "Log.h"
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    constexpr char SnapshotMagic[4] = { 'A', 'C', 'Q', 'S' };
+    constexpr uint32 SnapshotVersion = 1;                  // bump whenever the layout below changes
+
+    struct SnapshotHeader
+    {
+        char Magic[4];
+        uint32 Version;
+        uint32 EntryCount;
+        uint32 Reserved;
+    };
+
+    struct SnapshotEntry
+    {
+        uint64 Key;
+        uint64 Checksum;
+        uint64 ContentHash;
+        uint64 RowCount;
+        uint64 Offset;                                     // from the start of the file
+        uint64 Size;
+    };
+
+    // FNV-1a, only used to detect changed queries and damaged entries
+    uint64 Hash(std::string_view data, uint64 hash = 14695981039346656037ULL)
+    {
+        for (char c : data)
+        {
+            hash ^= uint8(c);
+            hash *= 1099511628211ULL;
+        }
+
+        return hash;
+    }
+
+    class SnapshotWriter
+    {
+    public:
+        explicit SnapshotWriter(std::vector<char>& buffer) : _buffer(buffer) { }
+
+        template<typename T>
+        void Put(T value)
+        {
+            char const* bytes = reinterpret_cast<char const*>(&value);
+            _buffer.insert(_buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        void PutString(std::string const& value)
+        {
+            Put(uint16(value.size()));
+            _buffer.insert(_buffer.end(), value.begin(), value.end());
+        }
+
+        void PutValue(Field const& field)
+        {
+            if (field.IsNull())
+            {
+                Put(QuerySnapshot::NULL_LENGTH);
+                return;
+            }
+
+            std::string_view value = field.Get<std::string_view>();
+            Put(uint32(value.size()));
+            _buffer.insert(_buffer.end(), value.begin(), value.end());
+            _buffer.push_back('\0');                       // Field converts numbers from C strings
+        }
+
+    private:
+        std::vector<char>& _buffer;
+    };
+
+    class SnapshotReader
+    {
+    public:
+        SnapshotReader(char const* data, std::size_t size) : _pos(data), _end(data + size) { }
+
+        template<typename T>
+        bool Read(T& value)
+        {
+            if (std::size_t(_end - _pos) < sizeof(T))
+                return false;
+
+            std::memcpy(&value, _pos, sizeof(T));
+            _pos += sizeof(T);
+            return true;
+        }
+
+        bool ReadString(std::string& value)
+        {
+            uint16 length;
+            if (!Read(length) || std::size_t(_end - _pos) < length)
+                return false;
+
+            value.assign(_pos, length);
+            _pos += length;
+            return true;
+        }
+
+        [[nodiscard]] char const* GetPosition() const { return _pos; }
+        [[nodiscard]] char const* GetEnd() const { return _end; }
+
+    private:
+        char const* _pos;
+        char const* _end;
+    };
+}
+
+QuerySnapshot* QuerySnapshot::instance()
+{
+    static QuerySnapshot instance;
+    return &instance;
+}
+
+void QuerySnapshot::Open(std::string const& fileName)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    _fileName = fileName;
+    _mapping.reset();
+    _stored.clear();
+    _current.clear();
+    _refreshed.clear();
+    _hits = 0;
+    _misses = 0;
+
+    if (_fileName.empty())
+        return;
+
+    std::error_code error;
+    if (!std::filesystem::exists(_fileName, error) || !std::filesystem::file_size(_fileName, error))
+    {
+        LOG_INFO("sql.sql", "Static data snapshot '{}' does not exist yet, it is written once the world data is loaded.", _fileName);
+        return;
+    }
+
+    std::shared_ptr<boost::iostreams::mapped_file_source> file;
+    try
+    {
+        file = std::make_shared<boost::iostreams::mapped_file_source>(_fileName);
+    }
+    catch (std::exception const& e)
+    {
+        LOG_ERROR("sql.sql", "Cannot map static data snapshot '{}': {}. Loading from the database.", _fileName, e.what());
+        return;
+    }
+
+    SnapshotReader reader(file->data(), file->size());
+    SnapshotHeader header;
+    if (!reader.Read(header) || std::memcmp(header.Magic, SnapshotMagic, sizeof(SnapshotMagic)) != 0 || header.Version != SnapshotVersion)
+    {
+        LOG_WARN("sql.sql", "Static data snapshot '{}' has an unknown format, it is rebuilt from the database.", _fileName);
+        return;
+    }
+
+    for (uint32 i = 0; i < header.EntryCount; ++i)
+    {
+        SnapshotEntry entry;
+        if (!reader.Read(entry) || entry.Offset > file->size() || entry.Size > file->size() - entry.Offset)
+        {
+            LOG_WARN("sql.sql", "Static data snapshot '{}' is truncated, it is rebuilt from the database.", _fileName);
+            _stored.clear();
+            return;
+        }
+
+        _stored[entry.Key] = { entry.Checksum, entry.ContentHash, entry.RowCount, file->data() + entry.Offset, std::size_t(entry.Size) };
+    }
+
+    _mapping = std::move(file);
+}
+
+QueryResult QuerySnapshot::Query(std::string_view tables, std::string_view sql)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    if (_fileName.empty())
+        return WorldDatabase.Query(sql);
+
+    uint64 key = Hash(sql);
+    uint64 checksum = GetTablesChecksum(tables);
+
+    auto itr = _stored.find(key);
+    if (itr != _stored.end() && itr->second.Checksum == checksum && itr->second.ContentHash == Hash({ itr->second.Data, itr->second.Size }))
+    {
+        ++_hits;
+        _current[key] = itr->second;
+        return BuildResult(itr->second, _mapping);
+    }
+
+    // Query the database and store the rows in the snapshot layout, the loader reads them from there like from the file
+    std::shared_ptr<std::vector<char>> data = std::make_shared<std::vector<char>>();
+    SnapshotWriter writer(*data);
+    uint64 rowCount = 0;
+
+    if (QueryResult result = WorldDatabase.Query(sql))
+    {
+        writer.Put(result->GetFieldCount());
+        for (uint32 i = 0; i < result->GetFieldCount(); ++i)
+        {
+            QueryResultFieldMetadata const& meta = result->GetFieldMetadata(i);
+            writer.Put(uint8(meta.Type));
+            writer.PutString(meta.TableName);
+            writer.PutString(meta.TableAlias);
+            writer.PutString(meta.Name);
+            writer.PutString(meta.Alias);
+            writer.PutString(meta.TypeName);
+        }
+
+        do
+        {
+            Field* fields = result->Fetch();
+            for (uint32 i = 0; i < result->GetFieldCount(); ++i)
+                writer.PutValue(fields[i]);
+
+            ++rowCount;
+        } while (result->NextRow());
+    }
+    else
+        writer.Put(uint32(0));
+
+    ++_misses;
+    _refreshed.push_back(data);
+
+    Entry& entry = _current[key];
+    entry = { checksum, Hash({ data->data(), data->size() }), rowCount, data->data(), data->size() };
+    return BuildResult(entry, data);
+}
+
+void QuerySnapshot::Save()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    if (_fileName.empty())
+        return;
+
+    if (_misses || _current.size() != _stored.size())
+    {
+        // every process writes its own temporary file and replaces the snapshot at once, readers keep the old mapping
+        std::string tmpFile = Acore::StringFormat("{}.{}.tmp", _fileName, std::chrono::steady_clock::now().time_since_epoch().count());
+        bool written = false;
+        {
+            std::ofstream file(tmpFile, std::ios::out | std::ios::binary | std::ios::trunc);
+            if (file)
+            {
+                SnapshotHeader header = { };
+                std::memcpy(header.Magic, SnapshotMagic, sizeof(SnapshotMagic));
+                header.Version = SnapshotVersion;
+                header.EntryCount = uint32(_current.size());
+                file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+
+                uint64 offset = sizeof(SnapshotHeader) + _current.size() * sizeof(SnapshotEntry);
+                for (auto const& [key, entry] : _current)
+                {
+                    SnapshotEntry fileEntry = { key, entry.Checksum, entry.ContentHash, entry.RowCount, offset, entry.Size };
+                    file.write(reinterpret_cast<char const*>(&fileEntry), sizeof(fileEntry));
+                    offset += entry.Size;
+                }
+
+                for (auto const& [key, entry] : _current)
+                    file.write(entry.Data, entry.Size);
+
+                written = bool(file);
+            }
+        }
+
+        _mapping.reset();
+
+        if (!written)
+        {
+            LOG_ERROR("sql.sql", "Cannot write static data snapshot '{}'.", tmpFile);
+            std::remove(tmpFile.c_str());
+        }
+        else if (std::rename(tmpFile.c_str(), _fileName.c_str()) != 0)
+        {
+            LOG_ERROR("sql.sql", "Cannot replace static data snapshot '{}'.", _fileName);
+            std::remove(tmpFile.c_str());
+        }
+    }
+
+    LOG_INFO("server.loading", ">> Static data snapshot '{}': {} queries served from the snapshot, {} loaded from the database", _fileName, _hits, _misses);
+    LOG_INFO("server.loading", " ");
+
+    // later queries (.reload commands) always go to the database
+    _fileName.clear();
+    _mapping.reset();
+    _stored.clear();
+    _current.clear();
+    _refreshed.clear();
+}
+
+uint64 QuerySnapshot::GetTablesChecksum(std::string_view tables) const
+{
+    uint64 checksum = Hash(tables);
+
+    if (QueryResult result = WorldDatabase.Query("CHECKSUM TABLE {}", tables))
+    {
+        do
+        {
+            Field* fields = result->Fetch();
+            checksum = Hash(fields[0].Get<std::string_view>(), checksum);
+            checksum = Hash(fields[1].IsNull() ? "NULL" : fields[1].Get<std::string_view>(), checksum);
+        } while (result->NextRow());
+    }
+
+    return checksum;
+}
+
+QueryResult QuerySnapshot::BuildResult(Entry const& entry, std::shared_ptr<void const> const& owner) const
+{
+    SnapshotReader reader(entry.Data, entry.Size);
+
+    uint32 fieldCount = 0;
+    reader.Read(fieldCount);
+    if (!entry.RowCount)
+        return QueryResult(nullptr);
+
+    std::vector<QueryResultFieldMetadata> fieldMetadata(fieldCount);
+    for (uint32 i = 0; i < fieldCount; ++i)
+    {
+        QueryResultFieldMetadata& meta = fieldMetadata[i];
+        uint8 type = 0;
+        reader.Read(type);
+        reader.ReadString(meta.TableName);
+        reader.ReadString(meta.TableAlias);
+        reader.ReadString(meta.Name);
+        reader.ReadString(meta.Alias);
+        reader.ReadString(meta.TypeName);
+        meta.Index = i;
+        meta.Type = DatabaseFieldTypes(type);
+    }
+
+    QueryResult result = std::make_shared<ResultSet>(std::move(fieldMetadata), reader.GetPosition(), reader.GetEnd(), entry.RowCount, owner);
+    result->NextRow();
+    return result;
+}
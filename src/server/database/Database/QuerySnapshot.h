@@ -0,0 +1,89 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _QUERYSNAPSHOT_H
+#define _QUERYSNAPSHOT_H
+
+#include "DatabaseEnvFwd.h"
+#include "Define.h"
+#include "StringFormat.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+    @class QuerySnapshot
+
+    @brief Serves the static world database loaders from a memory mapped snapshot file
+
+    Every entry is keyed by the query text and stamped with CHECKSUM TABLE of the tables the query reads.
+    While the snapshot is open a query whose tables did not change is answered from the file, with field
+    values pointing straight into the mapping, anything else is queried from MySQL and stored again on Save().
+    The file only contains offsets, so several worldserver processes on one host can map it at the same time
+    and share its pages.
+*/
+class AC_DATABASE_API QuerySnapshot
+{
+public:
+    static constexpr uint32 NULL_LENGTH = 0xFFFFFFFF;
+
+    static QuerySnapshot* instance();
+
+    /// Maps the snapshot file, an empty name disables the snapshot and Query() goes straight to WorldDatabase
+    void Open(std::string const& fileName);
+
+    /// Rewrites the file when entries were refreshed and drops the mapping, results still in use keep their part of it alive
+    void Save();
+
+    /// tables is the list passed to CHECKSUM TABLE, it must name every table the query reads
+    QueryResult Query(std::string_view tables, std::string_view sql);
+
+    template<typename... Args>
+    QueryResult Query(std::string_view tables, std::string_view sql, Args&&... args)
+    {
+        return Query(tables, Acore::StringFormatFmt(sql, std::forward<Args>(args)...));
+    }
+
+private:
+    struct Entry
+    {
+        uint64 Checksum;
+        uint64 ContentHash;
+        uint64 RowCount;
+        char const* Data;                                  // field metadata followed by the rows
+        std::size_t Size;
+    };
+
+    uint64 GetTablesChecksum(std::string_view tables) const;
+    QueryResult BuildResult(Entry const& entry, std::shared_ptr<void const> const& owner) const;
+
+    std::string _fileName;
+    std::shared_ptr<void const> _mapping;
+    std::unordered_map<uint64, Entry> _stored;             // entries read from the file
+    std::unordered_map<uint64, Entry> _current;            // entries used by this startup, written by Save()
+    std::vector<std::shared_ptr<std::vector<char>>> _refreshed;
+    uint32 _hits = 0;
+    uint32 _misses = 0;
+    std::mutex _lock;
+};
+
+#define sQuerySnapshot QuerySnapshot::instance()
+
+#endif
@@ -503,6 +503,7 @@ void AchievementMgr::Reset()
     }
 
     _completedAchievements.clear();
+    _achievedBits.clear();
     _criteriaProgress.clear();
     DeleteFromDB(_player->GetGUID().GetCounter());
 
@@ -518,11 +519,11 @@ void AchievementMgr::ResetAchievementCriteria(AchievementCriteriaCondition condi
 
     LOG_DEBUG("achievement", "AchievementMgr::ResetAchievementCriteria({}, {}, {})", condition, value, evenIfCriteriaComplete);
 
-    AchievementCriteriaEntryList const* achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByCondition(condition, value);
+    AchievementCriteriaEntryVector const* achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByCondition(condition, value);
     if (!achievementCriteriaList)
         return;
 
-    for (AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList->begin(); i != achievementCriteriaList->end(); ++i)
+    for (AchievementCriteriaEntryVector::const_iterator i = achievementCriteriaList->begin(); i != achievementCriteriaList->end(); ++i)
     {
         AchievementCriteriaEntry const* achievementCriteria = (*i);
         AchievementEntry const* achievement = sAchievementStore.LookupEntry(achievementCriteria->referredAchievement);
@@ -625,6 +626,7 @@ void AchievementMgr::LoadFromDB(PreparedQueryResult achievementResult, PreparedQ
             CompletedAchievementData& ca = _completedAchievements[achievementid];
             ca.date = time_t(fields[1].Get<uint32>());
             ca.changed = false;
+            SetAchievedBit(achievementid);
 
             // title achievement rewards are retroactive
             if (AchievementReward const* reward = sAchievementMgr->GetAchievementReward(achievement))
@@ -800,72 +802,23 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
 
     LOG_DEBUG("achievement", "AchievementMgr::UpdateAchievementCriteria({}, {}, {})", type, miscValue1, miscValue2);
 
-    AchievementCriteriaEntryList const* achievementCriteriaList = nullptr;
-
-    switch (type)
-    {
-        case ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE:
-        case ACHIEVEMENT_CRITERIA_TYPE_WIN_BG:
-        case ACHIEVEMENT_CRITERIA_TYPE_REACH_SKILL_LEVEL:
-        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_ACHIEVEMENT:
-        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUESTS_IN_ZONE:
-        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_BATTLEGROUND:
-        case ACHIEVEMENT_CRITERIA_TYPE_KILLED_BY_CREATURE:
-        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUEST:
-        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET:
-        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL:
-        case ACHIEVEMENT_CRITERIA_TYPE_BG_OBJECTIVE_CAPTURE:
-        case ACHIEVEMENT_CRITERIA_TYPE_HONORABLE_KILL_AT_AREA:
-        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SPELL:
-        case ACHIEVEMENT_CRITERIA_TYPE_OWN_ITEM:
-        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LEVEL:
-        case ACHIEVEMENT_CRITERIA_TYPE_USE_ITEM:
-        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_ITEM:
-        case ACHIEVEMENT_CRITERIA_TYPE_EXPLORE_AREA:
-        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_REPUTATION:
-        case ACHIEVEMENT_CRITERIA_TYPE_HK_CLASS:
-        case ACHIEVEMENT_CRITERIA_TYPE_HK_RACE:
-        case ACHIEVEMENT_CRITERIA_TYPE_DO_EMOTE:
-        case ACHIEVEMENT_CRITERIA_TYPE_EQUIP_ITEM:
-        case ACHIEVEMENT_CRITERIA_TYPE_USE_GAMEOBJECT:
-        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET2:
-        case ACHIEVEMENT_CRITERIA_TYPE_FISH_IN_GAMEOBJECT:
-        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILLLINE_SPELLS:
-        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_TYPE:
-        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL2:
-        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LINE:
-            if (miscValue1)
-            {
-                achievementCriteriaList = sAchievementMgr->GetSpecialAchievementCriteriaByType(type, miscValue1);
-                break;
-            }
-            achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type);
-            break;
-        case ACHIEVEMENT_CRITERIA_TYPE_EQUIP_EPIC_ITEM:
-            if (miscValue2)
-            {
-                achievementCriteriaList = sAchievementMgr->GetSpecialAchievementCriteriaByType(type, miscValue2);
-                break;
-            }
-            achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type);
-            break;
-        default:
-            achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type);
-            break;
-    }
-
+    AchievementCriteriaEntryVector const* achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaForEvent(type, miscValue1, miscValue2);
     if (!achievementCriteriaList)
         return;
 
     sScriptMgr->OnBeforeCheckCriteria(this, achievementCriteriaList);
 
-    for (AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList->begin(); i != achievementCriteriaList->end(); ++i)
+    for (AchievementCriteriaEntryVector::const_iterator i = achievementCriteriaList->begin(); i != achievementCriteriaList->end(); ++i)
     {
         AchievementCriteriaEntry const* achievementCriteria = (*i);
         AchievementEntry const* achievement = sAchievementStore.LookupEntry(achievementCriteria->referredAchievement);
         if (!achievement)
             continue;
 
+        // cheap form of the completed check in CanUpdateCriteria, most criteria of a long played character end here
+        if (IsCriteriaClosed(achievement))
+            continue;
+
         if (!CanUpdateCriteria(achievementCriteria, achievement))
             continue;
 
@@ -1973,7 +1926,7 @@ bool AchievementMgr::IsCompletedAchievement(AchievementEntry const* entry)
     uint32 achievmentForTestId = entry->refAchievement ? entry->refAchievement : entry->ID;
     uint32 achievmentForTestCount = entry->count;
 
-    AchievementCriteriaEntryList const* cList = sAchievementMgr->GetAchievementCriteriaByAchievement(achievmentForTestId);
+    AchievementCriteriaEntryVector const* cList = sAchievementMgr->GetAchievementCriteriaByAchievement(achievmentForTestId);
     if (!cList)
         return false;
     uint32 count = 0;
@@ -1982,7 +1935,7 @@ bool AchievementMgr::IsCompletedAchievement(AchievementEntry const* entry)
     // Oddly, the target count is NOT countained in the achievement, but in each individual criteria
     if (entry->flags & ACHIEVEMENT_FLAG_SUMM)
     {
-        for (AchievementCriteriaEntryList::const_iterator itr = cList->begin(); itr != cList->end(); ++itr)
+        for (AchievementCriteriaEntryVector::const_iterator itr = cList->begin(); itr != cList->end(); ++itr)
         {
             AchievementCriteriaEntry const* criteria = *itr;
 
@@ -2001,7 +1954,7 @@ bool AchievementMgr::IsCompletedAchievement(AchievementEntry const* entry)
 
     // Default case - need complete all or
     bool completed_all = true;
-    for (AchievementCriteriaEntryList::const_iterator itr = cList->begin(); itr != cList->end(); ++itr)
+    for (AchievementCriteriaEntryVector::const_iterator itr = cList->begin(); itr != cList->end(); ++itr)
     {
         AchievementCriteriaEntry const* criteria = *itr;
 
@@ -2148,8 +2101,8 @@ void AchievementMgr::UpdateTimedAchievements(uint32 timeDiff)
 
 void AchievementMgr::StartTimedAchievement(AchievementCriteriaTimedTypes type, uint32 entry, uint32 timeLost /*= 0*/)
 {
-    AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr->GetTimedAchievementCriteriaByType(type);
-    for (AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList.begin(); i != achievementCriteriaList.end(); ++i)
+    AchievementCriteriaEntryVector const& achievementCriteriaList = sAchievementMgr->GetTimedAchievementCriteriaByType(type);
+    for (AchievementCriteriaEntryVector::const_iterator i = achievementCriteriaList.begin(); i != achievementCriteriaList.end(); ++i)
     {
         if ((*i)->timerStartEvent != entry)
             continue;
@@ -2171,8 +2124,8 @@ void AchievementMgr::StartTimedAchievement(AchievementCriteriaTimedTypes type, u
 
 void AchievementMgr::RemoveTimedAchievement(AchievementCriteriaTimedTypes type, uint32 entry)
 {
-    AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr->GetTimedAchievementCriteriaByType(type);
-    for (AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList.begin(); i != achievementCriteriaList.end(); ++i)
+    AchievementCriteriaEntryVector const& achievementCriteriaList = sAchievementMgr->GetTimedAchievementCriteriaByType(type);
+    for (AchievementCriteriaEntryVector::const_iterator i = achievementCriteriaList.begin(); i != achievementCriteriaList.end(); ++i)
     {
         if ((*i)->timerStartEvent != entry)
             continue;
@@ -2214,6 +2167,7 @@ void AchievementMgr::CompletedAchievement(AchievementEntry const* achievement)
     CompletedAchievementData& ca = _completedAchievements[achievement->ID];
     ca.date = GameTime::GetGameTime().count();
     ca.changed = true;
+    SetAchievedBit(achievement->ID);
 
     sScriptMgr->OnAchievementComplete(GetPlayer(), achievement);
 
@@ -2231,8 +2185,8 @@ void AchievementMgr::CompletedAchievement(AchievementEntry const* achievement)
                 }
 
         if (allRefsCompleted)
-            if (AchievementCriteriaEntryList const* cList = sAchievementMgr->GetAchievementCriteriaByAchievement(achiCheckId))
-                for (AchievementCriteriaEntryList::const_iterator itr = cList->begin(); itr != cList->end(); ++itr)
+            if (AchievementCriteriaEntryVector const* cList = sAchievementMgr->GetAchievementCriteriaByAchievement(achiCheckId))
+                for (AchievementCriteriaEntryVector::const_iterator itr = cList->begin(); itr != cList->end(); ++itr)
                     if (CriteriaProgress* progress = GetCriteriaProgress(*itr))
                     {
                         progress->changed = true;
@@ -2352,7 +2306,54 @@ void AchievementMgr::BuildAllDataPacket(WorldPacket* data) const
 
 bool AchievementMgr::HasAchieved(uint32 achievementId) const
 {
-    return _completedAchievements.find(achievementId) != _completedAchievements.end();
+    return achievementId < _achievedBits.size() && _achievedBits[achievementId];
+}
+
+void AchievementMgr::SetAchievedBit(uint32 achievementId)
+{
+    if (achievementId >= _achievedBits.size())
+        _achievedBits.resize(std::max<std::size_t>(achievementId + 1, sAchievementStore.GetNumRows()), false);
+
+    _achievedBits[achievementId] = true;
+}
+
+bool AchievementMgr::IsCriteriaClosed(AchievementEntry const* achievement) const
+{
+    // same result as the HasAchieved branch of IsCompletedCriteria for achievements nobody references
+    return HasAchieved(achievement->ID) && sAchievementMgr->IsCriteriaClosedOnCompletion(achievement->ID);
+}
+
+CriteriaDispatchStats AchievementMgr::DryRunCriteriaDispatch(AchievementCriteriaTypes type, uint32 miscValue1, uint32 miscValue2, bool useIndex)
+{
+    CriteriaDispatchStats stats;
+    if (type >= ACHIEVEMENT_CRITERIA_TYPE_TOTAL)
+        return stats;
+
+    AchievementCriteriaEntryVector const* achievementCriteriaList = useIndex
+        ? sAchievementMgr->GetAchievementCriteriaForEvent(type, miscValue1, miscValue2)
+        : sAchievementMgr->GetAchievementCriteriaByType(type);
+    if (!achievementCriteriaList)
+        return stats;
+
+    for (AchievementCriteriaEntry const* achievementCriteria : *achievementCriteriaList)
+    {
+        ++stats.Visited;
+
+        AchievementEntry const* achievement = sAchievementStore.LookupEntry(achievementCriteria->referredAchievement);
+        if (!achievement)
+            continue;
+
+        if (useIndex && IsCriteriaClosed(achievement))
+        {
+            ++stats.Skipped;
+            continue;
+        }
+
+        if (CanUpdateCriteria(achievementCriteria, achievement))
+            ++stats.Updatable;
+    }
+
+    return stats;
 }
 
 bool AchievementMgr::CanUpdateCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement)
@@ -2612,6 +2613,52 @@ void AchievementGlobalMgr::LoadAchievementCriteriaList()
     LOG_INFO("server.loading", " ");
 }
 
+AchievementCriteriaEntryVector const* AchievementGlobalMgr::GetAchievementCriteriaForEvent(AchievementCriteriaTypes type, uint32 miscValue1, uint32 miscValue2) const
+{
+    switch (type)
+    {
+        case ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_WIN_BG:
+        case ACHIEVEMENT_CRITERIA_TYPE_REACH_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_ACHIEVEMENT:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUESTS_IN_ZONE:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_BATTLEGROUND:
+        case ACHIEVEMENT_CRITERIA_TYPE_KILLED_BY_CREATURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUEST:
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_BG_OBJECTIVE_CAPTURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_HONORABLE_KILL_AT_AREA:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_OWN_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_EXPLORE_AREA:
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_REPUTATION:
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_CLASS:
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_RACE:
+        case ACHIEVEMENT_CRITERIA_TYPE_DO_EMOTE:
+        case ACHIEVEMENT_CRITERIA_TYPE_EQUIP_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_GAMEOBJECT:
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET2:
+        case ACHIEVEMENT_CRITERIA_TYPE_FISH_IN_GAMEOBJECT:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILLLINE_SPELLS:
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_TYPE:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL2:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LINE:
+            if (miscValue1)
+                return GetSpecialAchievementCriteriaByType(type, miscValue1);
+            return GetAchievementCriteriaByType(type);
+        case ACHIEVEMENT_CRITERIA_TYPE_EQUIP_EPIC_ITEM:
+            if (miscValue2)
+                return GetSpecialAchievementCriteriaByType(type, miscValue2);
+            return GetAchievementCriteriaByType(type);
+        default:
+            return GetAchievementCriteriaByType(type);
+    }
+}
+
 void AchievementGlobalMgr::LoadAchievementReferenceList()
 {
     uint32 oldMSTime = getMSTime();
@@ -2635,6 +2682,17 @@ void AchievementGlobalMgr::LoadAchievementReferenceList()
         ++count;
     }
 
+    // IsCompletedCriteria keeps the criteria of counters, realm firsts and referenced achievements open after completion
+    _criteriaClosedOnCompletion.assign(sAchievementStore.GetNumRows(), false);
+    for (uint32 entryId = 0; entryId < sAchievementStore.GetNumRows(); ++entryId)
+    {
+        AchievementEntry const* achievement = sAchievementStore.LookupEntry(entryId);
+        if (!achievement || achievement->flags & (ACHIEVEMENT_FLAG_COUNTER | ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL))
+            continue;
+
+        _criteriaClosedOnCompletion[entryId] = _achievementListByReferencedId.find(entryId) == _achievementListByReferencedId.end();
+    }
+
     LOG_INFO("server.loading", ">> Loaded {} achievement references in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
@@ -26,11 +26,14 @@
 #include <chrono>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
-typedef std::list<AchievementCriteriaEntry const*> AchievementCriteriaEntryList;
+typedef std::list<AchievementCriteriaEntry const*> AchievementCriteriaEntryList;  // kept for AchievementScript::OnBeforeCheckCriteria
+typedef std::vector<AchievementCriteriaEntry const*> AchievementCriteriaEntryVector;
 typedef std::list<AchievementEntry const*>         AchievementEntryList;
 
-typedef std::unordered_map<uint32, AchievementCriteriaEntryList> AchievementCriteriaListByAchievement;
+typedef std::unordered_map<uint32, AchievementCriteriaEntryVector> AchievementCriteriaListByAchievement;
 typedef std::map<uint32, AchievementEntryList>         AchievementListByReferencedId;
 
 struct CriteriaProgress
@@ -276,6 +279,14 @@ class Unit;
 class Player;
 class WorldPacket;
 
+/// Result of AchievementMgr::DryRunCriteriaDispatch, see .debug achievementbench
+struct CriteriaDispatchStats
+{
+    uint32 Visited = 0;     // criteria returned by the lookup
+    uint32 Skipped = 0;     // criteria of achievements already closed for the player
+    uint32 Updatable = 0;   // criteria passing CanUpdateCriteria
+};
+
 class AchievementMgr
 {
 public:
@@ -301,6 +312,10 @@ public:
     void RemoveCriteriaProgress(AchievementCriteriaEntry const* entry);
     CriteriaProgress* GetCriteriaProgress(AchievementCriteriaEntry const* entry);
 
+    /// Runs the criteria lookup and the CanUpdateCriteria filter of UpdateAchievementCriteria without changing any progress.
+    /// With useIndex false every criteria of the type is scanned and nothing is skipped, like before the per-event lookup existed.
+    CriteriaDispatchStats DryRunCriteriaDispatch(AchievementCriteriaTypes type, uint32 miscValue1, uint32 miscValue2, bool useIndex);
+
 private:
     enum ProgressType { PROGRESS_SET, PROGRESS_ACCUMULATE, PROGRESS_HIGHEST, PROGRESS_RESET };
     void SendAchievementEarned(AchievementEntry const* achievement) const;
@@ -310,11 +325,14 @@ private:
     bool IsCompletedCriteria(AchievementCriteriaEntry const* achievementCriteria, AchievementEntry const* achievement);
     bool IsCompletedAchievement(AchievementEntry const* entry);
     bool CanUpdateCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement);
+    [[nodiscard]] bool IsCriteriaClosed(AchievementEntry const* achievement) const;
+    void SetAchievedBit(uint32 achievementId);
     void BuildAllDataPacket(WorldPacket* data) const;
 
     Player* _player;
     CriteriaProgressMap _criteriaProgress;
     CompletedAchievementMap _completedAchievements;
+    std::vector<bool> _achievedBits;             // _completedAchievements indexed by achievement id, checked for every criteria visited
     typedef std::map<uint32, uint32> TimedAchievementMap;
     TimedAchievementMap _timedAchievements;      // Criteria id/time left in MS
 };
@@ -330,31 +348,38 @@ public:
     bool IsStatisticCriteria(AchievementCriteriaEntry const* achievementCriteria) const;
     bool IsStatisticAchievement(AchievementEntry const* achievement) const;
 
-    [[nodiscard]] AchievementCriteriaEntryList const* GetAchievementCriteriaByType(AchievementCriteriaTypes type) const
+    [[nodiscard]] AchievementCriteriaEntryVector const* GetAchievementCriteriaByType(AchievementCriteriaTypes type) const
     {
         return &_achievementCriteriasByType[type];
     }
 
-    AchievementCriteriaEntryList const* GetSpecialAchievementCriteriaByType(AchievementCriteriaTypes type, uint32 val)
+    [[nodiscard]] AchievementCriteriaEntryVector const* GetSpecialAchievementCriteriaByType(AchievementCriteriaTypes type, uint32 val) const
     {
-        if (_specialList[type].find(val) != _specialList[type].end())
-            return &_specialList[type][val];
-        return nullptr;
+        AchievementCriteriaListByValue::const_iterator itr = _specialList[type].find(val);
+        return itr != _specialList[type].end() ? &itr->second : nullptr;
     }
 
-    AchievementCriteriaEntryList const* GetAchievementCriteriaByCondition(AchievementCriteriaCondition condition, uint32 val)
+    [[nodiscard]] AchievementCriteriaEntryVector const* GetAchievementCriteriaByCondition(AchievementCriteriaCondition condition, uint32 val) const
     {
-        if (_achievementCriteriasByCondition[condition].find(val) != _achievementCriteriasByCondition[condition].end())
-            return &_achievementCriteriasByCondition[condition][val];
-        return nullptr;
+        AchievementCriteriaListByValue::const_iterator itr = _achievementCriteriasByCondition[condition].find(val);
+        return itr != _achievementCriteriasByCondition[condition].end() ? &itr->second : nullptr;
     }
 
-    [[nodiscard]] AchievementCriteriaEntryList const& GetTimedAchievementCriteriaByType(AchievementCriteriaTimedTypes type) const
+    /// Criteria that an event of the given type can update, narrowed down by the event's misc value where the type is indexed
+    [[nodiscard]] AchievementCriteriaEntryVector const* GetAchievementCriteriaForEvent(AchievementCriteriaTypes type, uint32 miscValue1, uint32 miscValue2) const;
+
+    /// True when completing the achievement also completes all of its criteria for good, so they never need to be checked again
+    [[nodiscard]] bool IsCriteriaClosedOnCompletion(uint32 achievementId) const
+    {
+        return achievementId < _criteriaClosedOnCompletion.size() && _criteriaClosedOnCompletion[achievementId];
+    }
+
+    [[nodiscard]] AchievementCriteriaEntryVector const& GetTimedAchievementCriteriaByType(AchievementCriteriaTimedTypes type) const
     {
         return _achievementCriteriasByTimedType[type];
     }
 
-    [[nodiscard]] AchievementCriteriaEntryList const* GetAchievementCriteriaByAchievement(uint32 id) const
+    [[nodiscard]] AchievementCriteriaEntryVector const* GetAchievementCriteriaByAchievement(uint32 id) const
     {
         AchievementCriteriaListByAchievement::const_iterator itr = _achievementCriteriaListByAchievement.find(id);
         return itr != _achievementCriteriaListByAchievement.end() ? &itr->second : nullptr;
@@ -400,8 +425,8 @@ private:
     AchievementCriteriaDataMap _criteriaDataMap;
 
     // store achievement criterias by type to speed up lookup
-    AchievementCriteriaEntryList _achievementCriteriasByType[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
-    AchievementCriteriaEntryList _achievementCriteriasByTimedType[ACHIEVEMENT_TIMED_TYPE_MAX];
+    AchievementCriteriaEntryVector _achievementCriteriasByType[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+    AchievementCriteriaEntryVector _achievementCriteriasByTimedType[ACHIEVEMENT_TIMED_TYPE_MAX];
     // store achievement criterias by achievement to speed up lookup
     AchievementCriteriaListByAchievement _achievementCriteriaListByAchievement;
     // store achievements by referenced achievement id to speed up lookup
@@ -413,9 +438,13 @@ private:
     AchievementRewards _achievementRewards;
     AchievementRewardLocales _achievementRewardLocales;
 
+    // not counters, not realm firsts and not referenced by other achievements, indexed by achievement id
+    std::vector<bool> _criteriaClosedOnCompletion;
+
     // pussywizard:
-    std::map<uint32, AchievementCriteriaEntryList> _specialList[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
-    std::map<uint32, AchievementCriteriaEntryList> _achievementCriteriasByCondition[ACHIEVEMENT_CRITERIA_CONDITION_TOTAL];
+    typedef std::unordered_map<uint32, AchievementCriteriaEntryVector> AchievementCriteriaListByValue;
+    AchievementCriteriaListByValue _specialList[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+    AchievementCriteriaListByValue _achievementCriteriasByCondition[ACHIEVEMENT_CRITERIA_CONDITION_TOTAL];
 };
 
 #define sAchievementMgr AchievementGlobalMgr::instance()
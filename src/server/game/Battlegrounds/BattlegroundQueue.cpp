@@ -56,6 +56,8 @@ BattlegroundQueue::BattlegroundQueue()
 
     _queueAnnouncementTimer.fill(-1);
     _queueAnnouncementCrossfactioned = false;
+    _ratedQueueChanged.fill(false);
+    _nextRatedWindowChange.fill(0);
 }
 
 BattlegroundQueue::~BattlegroundQueue()
@@ -218,6 +220,7 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* group, Battle
 
     //add GroupInfo to m_QueuedGroups
     m_QueuedGroups[bracketId][index].push_back(ginfo);
+    AddRatedTeam(ginfo);
 
     // announce world (this doesn't need mutex)
     SendJoinMessageArenaQueue(leader, ginfo, bracketEntry, isRated);
@@ -382,6 +385,7 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     // remove group queue info no players left
     if (groupInfo->Players.empty())
     {
+        RemoveRatedTeam(groupInfo);
         m_QueuedGroups[_bracketId][_groupType].erase(group_itr);
         delete groupInfo;
         return;
@@ -866,135 +870,184 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
     // check if can start new rated arenas (can create many in single queue update)
     else if (bg_template->isArena())
     {
-        // found out the minimum and maximum ratings the newly added team should battle against
-        // arenaRating is the rating of the latest joined team, or 0
-        // 0 is on (automatic update call) and we must set it to team's with longest wait time
-        if (!arenaRating)
+        // arenaRating is the rating of the latest joined team, or 0 for the periodic update, which has nothing to do
+        // when no team joined or left since the last search and no rating window widened in the meantime
+        uint32 now = uint32(GameTime::GetGameTimeMS().count());
+        if (!arenaRating && !_ratedQueueChanged[bracket_id] && int32(now - _nextRatedWindowChange[bracket_id]) < 0)
+            return;
+
+        while (MatchRatedArenaTeams(bgTypeId, bracket_id, bracketEntry, arenaType, arenaRating))
+            arenaRating = 0;
+
+        _ratedQueueChanged[bracket_id] = false;
+    }
+}
+
+void BattlegroundQueue::AddRatedTeam(GroupQueueInfo* ginfo)
+{
+    if (!ginfo->IsRated || !ginfo->ArenaType || ginfo->IsInvitedToBGInstanceGUID)
+        return;
+
+    _ratedTeams[ginfo->BracketId].emplace(ginfo->ArenaMatchmakerRating, ginfo);
+    _ratedQueueChanged[ginfo->BracketId] = true;
+}
+
+void BattlegroundQueue::RemoveRatedTeam(GroupQueueInfo* ginfo)
+{
+    if (!ginfo->IsRated || !ginfo->ArenaType || ginfo->IsInvitedToBGInstanceGUID)
+        return;
+
+    RatedTeamsByRating& teams = _ratedTeams[ginfo->BracketId];
+    auto bounds = teams.equal_range(ginfo->ArenaMatchmakerRating);
+    for (auto itr = bounds.first; itr != bounds.second; ++itr)
+    {
+        if (itr->second == ginfo)
         {
-            GroupQueueInfo* front1 = nullptr;
-            GroupQueueInfo* front2 = nullptr;
+            teams.erase(itr);
+            _ratedQueueChanged[ginfo->BracketId] = true;
+            return;
+        }
+    }
+}
 
-            if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].empty())
-            {
-                front1 = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].front();
-                arenaRating = front1->ArenaMatchmakerRating;
-            }
+bool BattlegroundQueue::MatchRatedArenaTeams(BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id, PvPDifficultyEntry const* bracketEntry, uint8 arenaType, uint32 arenaRating)
+{
+    uint32 now = uint32(GameTime::GetGameTimeMS().count());
+    RatedTeamsByRating const& ratedTeams = _ratedTeams[bracket_id];
+    if (ratedTeams.empty())
+    {
+        // nothing can change until a team joins
+        _nextRatedWindowChange[bracket_id] = now + std::numeric_limits<int32>::max();
+        return false;
+    }
+
+    uint32 ratingDiscardTimer = sBattlegroundMgr->GetRatingDiscardTimer();
+    uint32 opponentsDiscardTimer = sWorld->getIntConfig(CONFIG_ARENA_PREV_OPPONENTS_DISCARD_TIMER);
+
+    // if max rating difference is set and the time past since server startup is greater than the rating discard time
+    // (after what time the ratings aren't taken into account when making teams) then
+    // the discard time is current_time - time_to_discard, teams that joined after that, will have their ratings taken into account
+    // else leave the discard time on 0, this way all ratings will be discarded
+    // this has to be signed value - when the server starts, this value would be negative and thus overflow
+    int32 discardTime = GameTime::GetGameTimeMS().count() - ratingDiscardTimer;
+
+    // timer for previous opponents
+    int32 discardOpponentsTime = GameTime::GetGameTimeMS().count() - opponentsDiscardTimer;
+
+    // teams that waited longer than the discard timer accept any rating. They joined first, so they are at the
+    // front of the queues, followed by the teams whose rating window or previous opponent exclusion expires next
+    std::vector<GroupQueueInfo*> candidates;
+    int32 nextWindowChange = std::numeric_limits<int32>::max();
+    GroupQueueInfo* oldest = nullptr;
+    for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; i++)
+    {
+        for (GroupQueueInfo* ginfo : m_QueuedGroups[bracket_id][i])
+        {
+            if (ginfo->IsInvitedToBGInstanceGUID)
+                continue;
+
+            if (!oldest || ginfo->JoinTime < oldest->JoinTime)
+                oldest = ginfo;
+
+            bool opponentsDiscarded = (int32)ginfo->JoinTime < discardOpponentsTime;
+            if (!opponentsDiscarded && ginfo->PreviousOpponentsTeamId)
+                nextWindowChange = std::min(nextWindowChange, int32(ginfo->JoinTime + opponentsDiscardTimer - now));
 
-            if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].empty())
+            if ((int32)ginfo->JoinTime < discardTime)
             {
-                front2 = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].front();
-                arenaRating = front2->ArenaMatchmakerRating;
+                candidates.push_back(ginfo);
+                continue;
             }
 
-            if (front1 && front2)
+            nextWindowChange = std::min(nextWindowChange, int32(ginfo->JoinTime + ratingDiscardTimer - now));
+
+            // every team after this one joined later, so its windows expire later too
+            if (!opponentsDiscarded)
             {
-                if (front1->JoinTime < front2->JoinTime)
-                    arenaRating = front1->ArenaMatchmakerRating;
+                nextWindowChange = std::min(nextWindowChange, int32(ginfo->JoinTime + opponentsDiscardTimer - now));
+                break;
             }
-            else if (!front1 && !front2)
-                return; // queues are empty
         }
+    }
 
-        //set rating range
-        uint32 arenaMinRating = (arenaRating <= sBattlegroundMgr->GetMaxRatingDifference()) ? 0 : arenaRating - sBattlegroundMgr->GetMaxRatingDifference();
-        uint32 arenaMaxRating = arenaRating + sBattlegroundMgr->GetMaxRatingDifference();
+    // found out the minimum and maximum ratings the newly added team should battle against,
+    // 0 is on (automatic update call) and we must set it to team's with longest wait time
+    if (!arenaRating && oldest)
+        arenaRating = oldest->ArenaMatchmakerRating;
 
-        // if max rating difference is set and the time past since server startup is greater than the rating discard time
-        // (after what time the ratings aren't taken into account when making teams) then
-        // the discard time is current_time - time_to_discard, teams that joined after that, will have their ratings taken into account
-        // else leave the discard time on 0, this way all ratings will be discarded
-        // this has to be signed value - when the server starts, this value would be negative and thus overflow
-        int32 discardTime = GameTime::GetGameTimeMS().count() - sBattlegroundMgr->GetRatingDiscardTimer();
+    uint32 arenaMinRating = (arenaRating <= sBattlegroundMgr->GetMaxRatingDifference()) ? 0 : arenaRating - sBattlegroundMgr->GetMaxRatingDifference();
+    uint32 arenaMaxRating = arenaRating + sBattlegroundMgr->GetMaxRatingDifference();
 
-        // timer for previous opponents
-        int32 discardOpponentsTime = GameTime::GetGameTimeMS().count() - sWorld->getIntConfig(CONFIG_ARENA_PREV_OPPONENTS_DISCARD_TIMER);
+    for (auto itr = ratedTeams.lower_bound(arenaMinRating); itr != ratedTeams.end() && itr->first <= arenaMaxRating; ++itr)
+        if ((int32)itr->second->JoinTime >= discardTime)
+            candidates.push_back(itr->second);
 
-        // we need to find 2 teams which will play next game
-        GroupsQueueType::iterator itr_teams[PVP_TEAMS_COUNT];
-        uint8 found = 0;
-        uint8 team = 0;
+    // the team that joined first plays against the next team that joined first and may play against it
+    std::sort(candidates.begin(), candidates.end(), [](GroupQueueInfo const* left, GroupQueueInfo const* right) { return left->JoinTime < right->JoinTime; });
 
-        for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; i++)
+    GroupQueueInfo* aTeam = nullptr;
+    GroupQueueInfo* hTeam = nullptr;
+    for (std::size_t i = 0; i < candidates.size() && !hTeam; ++i)
+    {
+        for (std::size_t j = i + 1; j < candidates.size(); ++j)
         {
-            // take the group that joined first
-            GroupsQueueType::iterator itr2 = m_QueuedGroups[bracket_id][i].begin();
-            for (; itr2 != m_QueuedGroups[bracket_id][i].end(); ++itr2)
+            GroupQueueInfo* first = candidates[i];
+            GroupQueueInfo* second = candidates[j];
+            if (first->ArenaTeamId != second->ArenaTeamId
+                && (first->ArenaTeamId != second->PreviousOpponentsTeamId || (int32)second->JoinTime < discardOpponentsTime)
+                && (second->ArenaTeamId != first->PreviousOpponentsTeamId || (int32)first->JoinTime < discardOpponentsTime))
             {
-                // if group match conditions, then add it to pool
-                if (!(*itr2)->IsInvitedToBGInstanceGUID
-                    && (((*itr2)->ArenaMatchmakerRating >= arenaMinRating && (*itr2)->ArenaMatchmakerRating <= arenaMaxRating)
-                        || (int32)(*itr2)->JoinTime < discardTime))
-                {
-                    itr_teams[found++] = itr2;
-                    team = i;
-                    break;
-                }
+                aTeam = first;
+                hTeam = second;
+                break;
             }
         }
+    }
 
-        if (!found)
-            return;
-
-        if (found == 1)
-        {
-            for (GroupsQueueType::iterator itr3 = itr_teams[0]; itr3 != m_QueuedGroups[bracket_id][team].end(); ++itr3)
-            {
-                if (!(*itr3)->IsInvitedToBGInstanceGUID
-                    && (((*itr3)->ArenaMatchmakerRating >= arenaMinRating && (*itr3)->ArenaMatchmakerRating <= arenaMaxRating) || (int32)(*itr3)->JoinTime < discardTime)
-                    && ((*(itr_teams[0]))->ArenaTeamId != (*itr3)->PreviousOpponentsTeamId || ((int32)(*itr3)->JoinTime < discardOpponentsTime))
-                    && (*(itr_teams[0]))->ArenaTeamId != (*itr3)->ArenaTeamId)
-                {
-                    itr_teams[found++] = itr3;
-                    break;
-                }
-            }
-        }
+    if (!aTeam)
+    {
+        _nextRatedWindowChange[bracket_id] = now + uint32(std::max(nextWindowChange, 0));
+        return false;
+    }
 
-        //if we have 2 teams, then start new arena and invite players!
-        if (found == 2)
-        {
-            GroupQueueInfo* aTeam = *(itr_teams[TEAM_ALLIANCE]);
-            GroupQueueInfo* hTeam = *(itr_teams[TEAM_HORDE]);
+    Battleground* arena = sBattlegroundMgr->CreateNewBattleground(bgTypeId, bracketEntry, arenaType, true);
+    if (!arena)
+    {
+        LOG_ERROR("bg.battleground", "BattlegroundQueue::Update couldn't create arena instance for rated arena match!");
+        return false;
+    }
 
-            Battleground* arena = sBattlegroundMgr->CreateNewBattleground(bgTypeId, bracketEntry, arenaType, true);
-            if (!arena)
-            {
-                LOG_ERROR("bg.battleground", "BattlegroundQueue::Update couldn't create arena instance for rated arena match!");
-                return;
-            }
+    aTeam->OpponentsTeamRating = hTeam->ArenaTeamRating;
+    hTeam->OpponentsTeamRating = aTeam->ArenaTeamRating;
+    aTeam->OpponentsMatchmakerRating = hTeam->ArenaMatchmakerRating;
+    hTeam->OpponentsMatchmakerRating = aTeam->ArenaMatchmakerRating;
 
-            aTeam->OpponentsTeamRating = hTeam->ArenaTeamRating;
-            hTeam->OpponentsTeamRating = aTeam->ArenaTeamRating;
-            aTeam->OpponentsMatchmakerRating = hTeam->ArenaMatchmakerRating;
-            hTeam->OpponentsMatchmakerRating = aTeam->ArenaMatchmakerRating;
+    LOG_DEBUG("bg.battleground", "setting oposite teamrating for team {} to {}", aTeam->ArenaTeamId, aTeam->OpponentsTeamRating);
+    LOG_DEBUG("bg.battleground", "setting oposite teamrating for team {} to {}", hTeam->ArenaTeamId, hTeam->OpponentsTeamRating);
 
-            LOG_DEBUG("bg.battleground", "setting oposite teamrating for team {} to {}", aTeam->ArenaTeamId, aTeam->OpponentsTeamRating);
-            LOG_DEBUG("bg.battleground", "setting oposite teamrating for team {} to {}", hTeam->ArenaTeamId, hTeam->OpponentsTeamRating);
+    // now we must move team if we changed its faction to another faction queue, because then we will spam log by errors in Queue::RemovePlayer
+    auto moveToQueue = [this, bracket_id](GroupQueueInfo* ginfo, uint8 groupType)
+    {
+        if (ginfo->GroupType == groupType)
+            return;
 
-            // now we must move team if we changed its faction to another faction queue, because then we will spam log by errors in Queue::RemovePlayer
-            if (aTeam->teamId != TEAM_ALLIANCE)
-            {
-                aTeam->GroupType = BG_QUEUE_PREMADE_ALLIANCE;
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].push_front(aTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].erase(itr_teams[TEAM_ALLIANCE]);
-            }
+        GroupsQueueType& previousQueue = m_QueuedGroups[bracket_id][ginfo->GroupType];
+        previousQueue.erase(std::find(previousQueue.begin(), previousQueue.end(), ginfo));
+        ginfo->GroupType = groupType;
+        m_QueuedGroups[bracket_id][groupType].push_front(ginfo);
+    };
 
-            if (hTeam->teamId != TEAM_HORDE)
-            {
-                hTeam->GroupType = BG_QUEUE_PREMADE_HORDE;
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].push_front(hTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].erase(itr_teams[TEAM_HORDE]);
-            }
+    moveToQueue(aTeam, BG_QUEUE_PREMADE_ALLIANCE);
+    moveToQueue(hTeam, BG_QUEUE_PREMADE_HORDE);
 
-            arena->SetArenaMatchmakerRating(TEAM_ALLIANCE, aTeam->ArenaMatchmakerRating);
-            arena->SetArenaMatchmakerRating(TEAM_HORDE, hTeam->ArenaMatchmakerRating);
-            InviteGroupToBG(aTeam, arena, TEAM_ALLIANCE);
-            InviteGroupToBG(hTeam, arena, TEAM_HORDE);
+    arena->SetArenaMatchmakerRating(TEAM_ALLIANCE, aTeam->ArenaMatchmakerRating);
+    arena->SetArenaMatchmakerRating(TEAM_HORDE, hTeam->ArenaMatchmakerRating);
+    InviteGroupToBG(aTeam, arena, TEAM_ALLIANCE);
+    InviteGroupToBG(hTeam, arena, TEAM_HORDE);
 
-            LOG_DEBUG("bg.battleground", "Starting rated arena match!");
-            arena->StartBattleground();
-        }
-    }
+    LOG_DEBUG("bg.battleground", "Starting rated arena match!");
+    arena->StartBattleground();
+    return true;
 }
 
 void BattlegroundQueue::BattlegroundQueueAnnouncerUpdate(uint32 diff, BattlegroundQueueTypeId bgQueueTypeId, BattlegroundBracketId bracket_id)
@@ -1238,13 +1291,14 @@ void BattlegroundQueue::InviteGroupToBG(GroupQueueInfo* ginfo, Battleground* bg,
     if (ginfo->IsInvitedToBGInstanceGUID)
         return;
 
-    // set invitation
-    ginfo->IsInvitedToBGInstanceGUID = bg->GetInstanceID();
-
     BattlegroundTypeId bgTypeId = bg->GetBgTypeID();
     BattlegroundQueueTypeId bgQueueTypeId = BattlegroundMgr::BGQueueTypeId(ginfo->BgTypeId, ginfo->ArenaType);
     BattlegroundQueue& bgQueue = sBattlegroundMgr->GetBattlegroundQueue(bgQueueTypeId);
 
+    // set invitation, invited teams don't look for opponents anymore
+    bgQueue.RemoveRatedTeam(ginfo);
+    ginfo->IsInvitedToBGInstanceGUID = bg->GetInstanceID();
+
     // set ArenaTeamId for rated matches
     if (bg->isArena() && bg->isRated())
         bg->SetArenaTeamIdForTeam(ginfo->teamId, ginfo->ArenaTeamId);
@@ -24,6 +24,7 @@
 #include "EventProcessor.h"
 #include <array>
 #include <deque>
+#include <map>
 
 constexpr auto COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME = 10;
 
@@ -128,7 +129,14 @@ public:
     void SetQueueAnnouncementTimer(uint32 bracketId, int32 timer, bool isCrossFactionBG = true);
     [[nodiscard]] int32 GetQueueAnnouncementTimer(uint32 bracketId) const;
 
+    // rated arena teams not invited yet, by matchmaker rating
+    typedef std::multimap<uint32, GroupQueueInfo*> RatedTeamsByRating;
+
 private:
+    void AddRatedTeam(GroupQueueInfo* ginfo);
+    void RemoveRatedTeam(GroupQueueInfo* ginfo);
+    bool MatchRatedArenaTeams(BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id, PvPDifficultyEntry const* bracketEntry, uint8 arenaType, uint32 arenaRating);
+
     uint32 m_WaitTimes[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS][COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME];
     uint32 m_WaitTimeLastIndex[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
 
@@ -137,6 +145,12 @@ private:
 
     std::array<int32, MAX_BATTLEGROUND_BRACKETS> _queueAnnouncementTimer;
     bool _queueAnnouncementCrossfactioned;
+
+    // rated arena matching only runs again when a team joined or left the bracket,
+    // or when a waiting team's rating window or previous opponent exclusion expired
+    std::array<RatedTeamsByRating, MAX_BATTLEGROUND_BRACKETS> _ratedTeams;
+    std::array<bool, MAX_BATTLEGROUND_BRACKETS> _ratedQueueChanged;
+    std::array<uint32, MAX_BATTLEGROUND_BRACKETS> _nextRatedWindowChange; // game time in ms, truncated like GroupQueueInfo::JoinTime
 };
 
 /*
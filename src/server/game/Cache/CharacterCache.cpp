@@ -17,17 +17,186 @@
 
 #include "CharacterCache.h"
 #include "ArenaTeam.h"
+#include "CharacterNameHash.h"
 #include "DatabaseEnv.h"
 #include "Log.h"
+#include "MySQLThreading.h"
 #include "Player.h"
 #include "Timer.h"
+#include "Util.h"
 #include "World.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 namespace
 {
-    std::unordered_map<ObjectGuid, CharacterCacheEntry> _characterCacheStore;
-    std::unordered_map<std::string, CharacterCacheEntry*> _characterCacheByNameStore;
+    // character guids read by one query of LoadCharacterCacheStorage
+    constexpr uint32 CHARACTER_CACHE_LOAD_BATCH = 50000;
+
+    /**
+     * One character. Entries are immutable once published, every update stores a changed copy,
+     * so readers never see a half written entry. A rename replaces the whole slot.
+     */
+    struct CharacterCacheSlot
+    {
+        CharacterCacheSlot(std::string name, std::shared_ptr<CharacterCacheEntry const> entry) : Name(std::move(name)), Entry(std::move(entry)) { }
+
+        std::string const Name;                                 // the name index keys view this string
+        std::shared_ptr<CharacterCacheEntry const> Entry;       // only accessed with std::atomic_load/std::atomic_store
+    };
+
+    typedef std::unordered_map<ObjectGuid, std::shared_ptr<CharacterCacheSlot>> CharacterCacheGuidIndex;
+    typedef std::unordered_map<std::string_view, std::shared_ptr<CharacterCacheSlot>, CharacterNameHash, CharacterNameEqual> CharacterCacheNameIndex;
+
+    /**
+     * Read without locks: every index shard is an immutable map published through an atomic shared_ptr.
+     * Writers serialize on WriteLock and publish a changed copy of the one shard they touch, which only
+     * happens when a character is added, renamed or deleted. Field updates only swap the slot's entry.
+     */
+    struct CharacterCacheStore
+    {
+        static constexpr uint32 SHARD_COUNT = 256;
+
+        CharacterCacheStore()
+        {
+            for (std::shared_ptr<CharacterCacheGuidIndex const>& shard : GuidShards)
+                shard = std::make_shared<CharacterCacheGuidIndex const>();
+
+            for (std::shared_ptr<CharacterCacheNameIndex const>& shard : NameShards)
+                shard = std::make_shared<CharacterCacheNameIndex const>();
+        }
+
+        static uint32 GetGuidShard(ObjectGuid const& guid) { return guid.GetCounter() % SHARD_COUNT; }
+        static uint32 GetNameShard(std::string_view name) { return CharacterNameHash()(name) % SHARD_COUNT; }
+
+        std::array<std::shared_ptr<CharacterCacheGuidIndex const>, SHARD_COUNT> GuidShards;
+        std::array<std::shared_ptr<CharacterCacheNameIndex const>, SHARD_COUNT> NameShards;
+        std::mutex WriteLock;
+    };
+
+    CharacterCacheStore& GetStore()
+    {
+        static CharacterCacheStore store;
+        return store;
+    }
+
+    std::shared_ptr<CharacterCacheSlot> FindSlot(ObjectGuid const& guid)
+    {
+        CharacterCacheStore& store = GetStore();
+        std::shared_ptr<CharacterCacheGuidIndex const> shard = std::atomic_load_explicit(&store.GuidShards[CharacterCacheStore::GetGuidShard(guid)], std::memory_order_acquire);
+        auto itr = shard->find(guid);
+        return itr != shard->end() ? itr->second : nullptr;
+    }
+
+    std::shared_ptr<CharacterCacheSlot> FindSlot(std::string_view name)
+    {
+        CharacterCacheStore& store = GetStore();
+        std::shared_ptr<CharacterCacheNameIndex const> shard = std::atomic_load_explicit(&store.NameShards[CharacterCacheStore::GetNameShard(name)], std::memory_order_acquire);
+        auto itr = shard->find(name);
+        return itr != shard->end() ? itr->second : nullptr;
+    }
+
+    template<class Key>
+    std::shared_ptr<CharacterCacheEntry const> FindCharacterCacheEntry(Key const& key)
+    {
+        std::shared_ptr<CharacterCacheSlot> slot = FindSlot(key);
+        return slot ? std::atomic_load_explicit(&slot->Entry, std::memory_order_acquire) : nullptr;
+    }
+
+    /// Needs the store's WriteLock, publishes a copy of the shard changed by modifier
+    template<class Index, class Modifier>
+    void ModifyShard(std::shared_ptr<Index const>& shard, Modifier&& modifier)
+    {
+        auto copy = std::make_shared<Index>(*shard);
+        modifier(*copy);
+        std::atomic_store_explicit(&shard, std::shared_ptr<Index const>(std::move(copy)), std::memory_order_release);
+    }
+
+    /// Needs the store's WriteLock
+    void LinkSlot(std::shared_ptr<CharacterCacheSlot> const& slot, ObjectGuid const& guid)
+    {
+        CharacterCacheStore& store = GetStore();
+        ModifyShard(store.GuidShards[CharacterCacheStore::GetGuidShard(guid)], [&](CharacterCacheGuidIndex& index) { index[guid] = slot; });
+        ModifyShard(store.NameShards[CharacterCacheStore::GetNameShard(slot->Name)], [&](CharacterCacheNameIndex& index)
+        {
+            index.erase(slot->Name);
+            index.emplace(slot->Name, slot);
+        });
+    }
+
+    /// Needs the store's WriteLock, only drops the name key while it still belongs to the slot
+    void UnlinkSlotName(std::shared_ptr<CharacterCacheSlot> const& slot)
+    {
+        CharacterCacheStore& store = GetStore();
+        std::shared_ptr<CharacterCacheNameIndex const>& shard = store.NameShards[CharacterCacheStore::GetNameShard(slot->Name)];
+        auto itr = shard->find(slot->Name);
+        if (itr == shard->end() || itr->second != slot)
+            return;
+
+        ModifyShard(shard, [&](CharacterCacheNameIndex& index) { index.erase(slot->Name); });
+    }
+
+    /// Needs the store's WriteLock, publishes a changed copy of the character's entry
+    template<class Modifier>
+    void ModifyCharacterCacheEntry(ObjectGuid const& guid, Modifier&& modifier)
+    {
+        std::shared_ptr<CharacterCacheSlot> slot = FindSlot(guid);
+        if (!slot)
+            return;
+
+        auto entry = std::make_shared<CharacterCacheEntry>(*std::atomic_load_explicit(&slot->Entry, std::memory_order_relaxed));
+        modifier(*entry);
+        std::atomic_store_explicit(&slot->Entry, std::shared_ptr<CharacterCacheEntry const>(std::move(entry)), std::memory_order_release);
+    }
+
+    /// Needs the store's WriteLock
+    void InsertCharacterCacheEntry(CharacterCacheEntry const& entry)
+    {
+        auto data = std::make_shared<CharacterCacheEntry>(entry);
+        data->GuildId = 0;                          // Will be set in guild loading or guild setting
+        data->ArenaTeamId.fill(0);                  // Will be set in arena teams loading
+
+        std::shared_ptr<CharacterCacheSlot> slot = FindSlot(entry.Guid);
+        if (slot)
+        {
+            std::shared_ptr<CharacterCacheEntry const> old = std::atomic_load_explicit(&slot->Entry, std::memory_order_relaxed);
+            data->MailCount = old->MailCount;
+            data->GroupGuid = old->GroupGuid;
+
+            if (slot->Name == entry.Name)
+            {
+                std::atomic_store_explicit(&slot->Entry, std::shared_ptr<CharacterCacheEntry const>(std::move(data)), std::memory_order_release);
+                return;
+            }
+
+            UnlinkSlotName(slot);
+        }
+
+        LinkSlot(std::make_shared<CharacterCacheSlot>(entry.Name, std::move(data)), entry.Guid);
+    }
+
+    /// Indexes filled by LoadCharacterCacheStorage before they are published at once
+    struct CharacterCacheLoadIndexes
+    {
+        std::array<CharacterCacheGuidIndex, CharacterCacheStore::SHARD_COUNT> GuidShards;
+        std::array<CharacterCacheNameIndex, CharacterCacheStore::SHARD_COUNT> NameShards;
+        std::mutex Lock;
+        std::size_t Count = 0;
+
+        void Insert(CharacterCacheEntry const& entry)
+        {
+            auto slot = std::make_shared<CharacterCacheSlot>(entry.Name, std::make_shared<CharacterCacheEntry const>(entry));
+            GuidShards[CharacterCacheStore::GetGuidShard(entry.Guid)][entry.Guid] = slot;
+            NameShards[CharacterCacheStore::GetNameShard(slot->Name)].emplace(slot->Name, slot);
+            ++Count;
+        }
+    };
 }
 
 CharacterCache* CharacterCache::instance()
@@ -45,7 +214,7 @@ CharacterCache* CharacterCache::instance()
 * @return Name, Gender, Race, Class and Level of player character
 * Example Usage:
 * @code
-*    CharacterCacheEntry const* characterInfo = sCharacterCache->GetCharacterCacheByGuid(GUID);
+*    Optional<CharacterCacheEntry> characterInfo = sCharacterCache->GetCharacterCacheByGuid(GUID);
 *    if (!characterInfo)
 *        return;
 *
@@ -59,22 +228,90 @@ CharacterCache* CharacterCache::instance()
 
 void CharacterCache::LoadCharacterCacheStorage()
 {
-    _characterCacheStore.clear();
     uint32 oldMSTime = getMSTime();
 
-    QueryResult result = CharacterDatabase.Query("SELECT guid, name, account, race, gender, class, level FROM characters");
-    if (!result)
+    CharacterCacheStore& store = GetStore();
+    std::lock_guard<std::mutex> writeLock(store.WriteLock);
+
+    CharacterCacheLoadIndexes indexes;
+    auto publish = [&store, &indexes]()
     {
+        for (uint32 i = 0; i < CharacterCacheStore::SHARD_COUNT; ++i)
+        {
+            std::atomic_store_explicit(&store.GuidShards[i], std::make_shared<CharacterCacheGuidIndex const>(std::move(indexes.GuidShards[i])), std::memory_order_release);
+            std::atomic_store_explicit(&store.NameShards[i], std::make_shared<CharacterCacheNameIndex const>(std::move(indexes.NameShards[i])), std::memory_order_release);
+        }
+    };
+
+    QueryResult countResult = CharacterDatabase.Query("SELECT COUNT(*), MAX(guid) FROM characters");
+    uint64 characterCount = countResult ? countResult->Fetch()[0].Get<uint64>() : 0;
+    if (!characterCount)
+    {
+        publish();
         LOG_INFO("server.loading", "No character name data loaded, empty query!");
         return;
     }
 
-    do
+    uint64 maxGuid = countResult->Fetch()[1].Get<uint32>();
+
+    for (uint32 i = 0; i < CharacterCacheStore::SHARD_COUNT; ++i)
     {
-        Field* fields = result->Fetch();
-        AddCharacterCacheEntry(ObjectGuid::Create<HighGuid::Player>(fields[0].Get<uint32>()) /*guid*/, fields[2].Get<uint32>() /*account*/, fields[1].Get<std::string>() /*name*/,
-            fields[4].Get<uint8>() /*gender*/, fields[3].Get<uint8>() /*race*/, fields[5].Get<uint8>() /*class*/, fields[6].Get<uint8>() /*level*/);
-    } while (result->NextRow());
+        indexes.GuidShards[i].reserve(characterCount / CharacterCacheStore::SHARD_COUNT + 1);
+        indexes.NameShards[i].reserve(characterCount / CharacterCacheStore::SHARD_COUNT + 1);
+    }
+
+    // every thread queries the next free guid range, parses it and only locks the indexes to insert the parsed rows
+    std::atomic<uint64> nextGuid = 0;
+    auto loadBatches = [&nextGuid, &indexes, maxGuid]()
+    {
+        std::vector<CharacterCacheEntry> batch;
+        for (uint64 firstGuid = nextGuid.fetch_add(CHARACTER_CACHE_LOAD_BATCH); firstGuid <= maxGuid; firstGuid = nextGuid.fetch_add(CHARACTER_CACHE_LOAD_BATCH))
+        {
+            QueryResult result = CharacterDatabase.Query("SELECT guid, name, account, race, gender, class, level FROM characters WHERE guid BETWEEN {} AND {}",
+                firstGuid, firstGuid + CHARACTER_CACHE_LOAD_BATCH - 1);
+            if (!result)
+                continue;
+
+            batch.clear();
+            batch.reserve(result->GetRowCount());
+            do
+            {
+                Field* fields = result->Fetch();
+                CharacterCacheEntry& entry = batch.emplace_back();
+                entry.Guid = ObjectGuid::Create<HighGuid::Player>(fields[0].Get<uint32>());
+                entry.Name = fields[1].Get<std::string>();
+                entry.AccountId = fields[2].Get<uint32>();
+                entry.Race = fields[3].Get<uint8>();
+                entry.Sex = fields[4].Get<uint8>();
+                entry.Class = fields[5].Get<uint8>();
+                entry.Level = fields[6].Get<uint8>();
+            } while (result->NextRow());
+
+            result.reset();
+
+            std::lock_guard<std::mutex> lock(indexes.Lock);
+            for (CharacterCacheEntry const& entry : batch)
+                indexes.Insert(entry);
+        }
+    };
+
+    uint32 threadCount = std::clamp<uint32>(sWorld->getIntConfig(CONFIG_CHARACTER_CACHE_LOAD_THREADS), 1, 16);
+    std::vector<std::thread> threads;
+    for (uint32 i = 1; i < threadCount; ++i)
+    {
+        threads.emplace_back([&loadBatches]()
+        {
+            // the client library keeps per thread state, threads it did not create have to set it up themselves
+            MySQL::Thread_Init();
+            loadBatches();
+            MySQL::Thread_End();
+        });
+    }
+
+    loadBatches();
+
+    for (std::thread& thread : threads)
+        thread.join();
 
     QueryResult mailCountResult = CharacterDatabase.Query("SELECT receiver, COUNT(receiver) FROM mail GROUP BY receiver");
     if (mailCountResult)
@@ -82,11 +319,20 @@ void CharacterCache::LoadCharacterCacheStorage()
         do
         {
             Field* fields = mailCountResult->Fetch();
-            UpdateCharacterMailCount(ObjectGuid(HighGuid::Player, fields[0].Get<uint32>()), static_cast<int8>(fields[1].Get<uint64>()), true);
+            ObjectGuid guid(HighGuid::Player, fields[0].Get<uint32>());
+            auto itr = indexes.GuidShards[CharacterCacheStore::GetGuidShard(guid)].find(guid);
+            if (itr != indexes.GuidShards[CharacterCacheStore::GetGuidShard(guid)].end())
+            {
+                // nothing reads the entries before they are published
+                std::const_pointer_cast<CharacterCacheEntry>(itr->second->Entry)->MailCount = static_cast<int8>(fields[1].Get<uint64>());
+            }
         } while (mailCountResult->NextRow());
     }
 
-    LOG_INFO("server.loading", ">> Loaded Character Infos For {} Characters in {} ms", _characterCacheStore.size(), GetMSTimeDiffToNow(oldMSTime));
+    std::size_t count = indexes.Count;
+    publish();
+
+    LOG_INFO("server.loading", ">> Loaded Character Infos For {} Characters in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
 
@@ -121,133 +367,113 @@ Modifying functions
 */
 void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level)
 {
-    CharacterCacheEntry& data = _characterCacheStore[guid];
-    data.Guid = guid;
-    data.Name = name;
-    data.AccountId = accountId;
-    data.Race = race;
-    data.Sex = gender;
-    data.Class = playerClass;
-    data.Level = level;
-    data.GuildId = 0;                           // Will be set in guild loading or guild setting
-    for (uint8 i = 0; i < MAX_ARENA_SLOT; ++i)
-    {
-        data.ArenaTeamId[i] = 0; // Will be set in arena teams loading
-    }
-
-    // Fill Name to Guid Store
-    _characterCacheByNameStore[name] = &data;
+    CharacterCacheEntry entry{};
+    entry.Guid = guid;
+    entry.Name = name;
+    entry.AccountId = accountId;
+    entry.Race = race;
+    entry.Sex = gender;
+    entry.Class = playerClass;
+    entry.Level = level;
+
+    std::lock_guard<std::mutex> lock(GetStore().WriteLock);
+    InsertCharacterCacheEntry(entry);
 }
 
 void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name)
 {
-    _characterCacheStore.erase(guid);
-    _characterCacheByNameStore.erase(name);
+    CharacterCacheStore& store = GetStore();
+    std::lock_guard<std::mutex> lock(store.WriteLock);
+
+    std::shared_ptr<CharacterCacheSlot> namedSlot = FindSlot(std::string_view(name));
+    if (namedSlot && std::atomic_load_explicit(&namedSlot->Entry, std::memory_order_relaxed)->Guid == guid)
+        UnlinkSlotName(namedSlot);
+
+    // the entry may be indexed under another name than the given one (RefreshCacheEntry passes the new name)
+    if (std::shared_ptr<CharacterCacheSlot> slot = FindSlot(guid))
+    {
+        UnlinkSlotName(slot);
+        ModifyShard(store.GuidShards[CharacterCacheStore::GetGuidShard(guid)], [&](CharacterCacheGuidIndex& index) { index.erase(guid); });
+    }
 }
 
 void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string const& name, Optional<uint8> gender /*= {}*/, Optional<uint8> race /*= {}*/)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    std::lock_guard<std::mutex> lock(GetStore().WriteLock);
+    std::shared_ptr<CharacterCacheSlot> slot = FindSlot(guid);
+    if (!slot)
         return;
 
-    std::string oldName = itr->second.Name;
-    itr->second.Name = name;
+    auto entry = std::make_shared<CharacterCacheEntry>(*std::atomic_load_explicit(&slot->Entry, std::memory_order_relaxed));
+    entry->Name = name;
 
     if (gender)
     {
-        itr->second.Sex = *gender;
+        entry->Sex = *gender;
     }
 
     if (race)
     {
-        itr->second.Race = *race;
+        entry->Race = *race;
     }
 
+    // Correct name -> slot storage
+    UnlinkSlotName(slot);
+    LinkSlot(std::make_shared<CharacterCacheSlot>(name, std::move(entry)), guid);
+
     //WorldPackets::Misc::InvalidatePlayer packet(guid);
     //sWorld->SendGlobalMessage(packet.Write());
-
-    // Correct name -> pointer storage
-    _characterCacheByNameStore.erase(oldName);
-    _characterCacheByNameStore[name] = &itr->second;
 }
 
 void CharacterCache::UpdateCharacterLevel(ObjectGuid const& guid, uint8 level)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return;
-    }
-
-    itr->second.Level = level;
+    std::lock_guard<std::mutex> lock(GetStore().WriteLock);
+    ModifyCharacterCacheEntry(guid, [level](CharacterCacheEntry& entry) { entry.Level = level; });
 }
 
 void CharacterCache::UpdateCharacterAccountId(ObjectGuid const& guid, uint32 accountId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return;
-    }
-
-    itr->second.AccountId = accountId;
+    std::lock_guard<std::mutex> lock(GetStore().WriteLock);
+    ModifyCharacterCacheEntry(guid, [accountId](CharacterCacheEntry& entry) { entry.AccountId = accountId; });
 }
 
 void CharacterCache::UpdateCharacterGuildId(ObjectGuid const& guid, ObjectGuid::LowType guildId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return;
-    }
-
-    itr->second.GuildId = guildId;
+    std::lock_guard<std::mutex> lock(GetStore().WriteLock);
+    ModifyCharacterCacheEntry(guid, [guildId](CharacterCacheEntry& entry) { entry.GuildId = guildId; });
 }
 
 void CharacterCache::UpdateCharacterArenaTeamId(ObjectGuid const& guid, uint8 slot, uint32 arenaTeamId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return;
-    }
-
-    itr->second.ArenaTeamId[slot] = arenaTeamId;
+    std::lock_guard<std::mutex> lock(GetStore().WriteLock);
+    ModifyCharacterCacheEntry(guid, [slot, arenaTeamId](CharacterCacheEntry& entry) { entry.ArenaTeamId[slot] = arenaTeamId; });
 }
 
 void CharacterCache::UpdateCharacterMailCount(ObjectGuid const& guid, int8 count, bool update)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    std::lock_guard<std::mutex> lock(GetStore().WriteLock);
+    ModifyCharacterCacheEntry(guid, [count, update](CharacterCacheEntry& entry)
     {
-        return;
-    }
-
-    if (update)
-    {
-        itr->second.MailCount = count;
-        return;
-    }
+        if (update)
+        {
+            entry.MailCount = count;
+            return;
+        }
 
-    // Let's be safe and prevent overflow
-    if (!itr->second.MailCount && count < 0)
-    {
-        return;
-    }
+        // Let's be safe and prevent overflow
+        if (!entry.MailCount && count < 0)
+        {
+            return;
+        }
 
-    itr->second.MailCount += count;
+        entry.MailCount += count;
+    });
 }
 
 void CharacterCache::UpdateCharacterGroup(ObjectGuid const& guid, ObjectGuid groupGUID)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return;
-    }
-
-    itr->second.GroupGuid = groupGUID;
+    std::lock_guard<std::mutex> lock(GetStore().WriteLock);
+    ModifyCharacterCacheEntry(guid, [groupGUID](CharacterCacheEntry& entry) { entry.GroupGuid = groupGUID; });
 }
 
 /*
@@ -255,127 +481,81 @@ Getters
 */
 bool CharacterCache::HasCharacterCacheEntry(ObjectGuid const& guid) const
 {
-    return _characterCacheStore.find(guid) != _characterCacheStore.end();
+    return FindSlot(guid) != nullptr;
 }
 
-CharacterCacheEntry const* CharacterCache::GetCharacterCacheByGuid(ObjectGuid const& guid) const
+Optional<CharacterCacheEntry> CharacterCache::GetCharacterCacheByGuid(ObjectGuid const& guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr != _characterCacheStore.end())
-    {
-        return &itr->second;
-    }
+    if (std::shared_ptr<CharacterCacheEntry const> entry = FindCharacterCacheEntry(guid))
+        return *entry;
 
-    return nullptr;
+    return {};
 }
 
-CharacterCacheEntry const* CharacterCache::GetCharacterCacheByName(std::string const& name) const
+Optional<CharacterCacheEntry> CharacterCache::GetCharacterCacheByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-    {
-        return itr->second;
-    }
+    if (std::shared_ptr<CharacterCacheEntry const> entry = FindCharacterCacheEntry(std::string_view(name)))
+        return *entry;
 
-    return nullptr;
+    return {};
 }
 
 ObjectGuid CharacterCache::GetCharacterGuidByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-    {
-        return itr->second->Guid;
-    }
-
-    return ObjectGuid::Empty;
+    std::shared_ptr<CharacterCacheEntry const> entry = FindCharacterCacheEntry(std::string_view(name));
+    return entry ? entry->Guid : ObjectGuid::Empty;
 }
 
 bool CharacterCache::GetCharacterNameByGuid(ObjectGuid guid, std::string& name) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    std::shared_ptr<CharacterCacheEntry const> entry = FindCharacterCacheEntry(guid);
+    if (!entry)
     {
         return false;
     }
 
-    name = itr->second.Name;
+    name = entry->Name;
     return true;
 }
 
 uint32 CharacterCache::GetCharacterTeamByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return 0;
-    }
-
-    return Player::TeamIdForRace(itr->second.Race);
+    std::shared_ptr<CharacterCacheEntry const> entry = FindCharacterCacheEntry(guid);
+    return entry ? Player::TeamIdForRace(entry->Race) : 0;
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return 0;
-    }
-
-    return itr->second.AccountId;
+    std::shared_ptr<CharacterCacheEntry const> entry = FindCharacterCacheEntry(guid);
+    return entry ? entry->AccountId : 0;
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-    {
-        return itr->second->AccountId;
-    }
-
-    return 0;
+    std::shared_ptr<CharacterCacheEntry const> entry = FindCharacterCacheEntry(std::string_view(name));
+    return entry ? entry->AccountId : 0;
 }
 
 uint8 CharacterCache::GetCharacterLevelByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return 0;
-    }
-
-    return itr->second.Level;
+    std::shared_ptr<CharacterCacheEntry const> entry = FindCharacterCacheEntry(guid);
+    return entry ? entry->Level : 0;
 }
 
 ObjectGuid::LowType CharacterCache::GetCharacterGuildIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return 0;
-    }
-
-    return itr->second.GuildId;
+    std::shared_ptr<CharacterCacheEntry const> entry = FindCharacterCacheEntry(guid);
+    return entry ? entry->GuildId : 0;
 }
 
 uint32 CharacterCache::GetCharacterArenaTeamIdByGuid(ObjectGuid guid, uint8 type) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return 0;
-    }
-
-    return itr->second.ArenaTeamId[type];
+    std::shared_ptr<CharacterCacheEntry const> entry = FindCharacterCacheEntry(guid);
+    return entry ? entry->ArenaTeamId[type] : 0;
 }
 
 ObjectGuid CharacterCache::GetCharacterGroupGuidByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return ObjectGuid::Empty;
-    }
-
-    return itr->second.GroupGuid;
+    std::shared_ptr<CharacterCacheEntry const> entry = FindCharacterCacheEntry(guid);
+    return entry ? entry->GroupGuid : ObjectGuid::Empty;
 }
@@ -39,6 +39,7 @@ struct CharacterCacheEntry
     ObjectGuid GroupGuid;
 };
 
+/// Thread safe, getters read published snapshots without locking and return copies, lookups by name ignore case
 class AC_GAME_API CharacterCache
 {
     public:
@@ -63,8 +64,8 @@ class AC_GAME_API CharacterCache
         void IncreaseCharacterMailCount(ObjectGuid const& guid) { UpdateCharacterMailCount(guid, 1); };
 
         [[nodiscard]] bool HasCharacterCacheEntry(ObjectGuid const& guid) const;
-        [[nodiscard]] CharacterCacheEntry const* GetCharacterCacheByGuid(ObjectGuid const& guid) const;
-        [[nodiscard]] CharacterCacheEntry const* GetCharacterCacheByName(std::string const& name) const;
+        [[nodiscard]] Optional<CharacterCacheEntry> GetCharacterCacheByGuid(ObjectGuid const& guid) const;
+        [[nodiscard]] Optional<CharacterCacheEntry> GetCharacterCacheByName(std::string const& name) const;
 
         void UpdateCharacterGroup(ObjectGuid const& guid, ObjectGuid groupGUID);
         void ClearCharacterGroup(ObjectGuid const& guid) { UpdateCharacterGroup(guid, ObjectGuid::Empty); };
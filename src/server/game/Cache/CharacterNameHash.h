@@ -0,0 +1,87 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CharacterNameHash_h__
+#define CharacterNameHash_h__
+
+#include "Define.h"
+#include "Util.h"
+#include <string_view>
+#include <utf8.h>
+
+/// Walks a name code point by code point in lower case, names that are no valid utf8 are walked byte by byte
+class LowerNameReader
+{
+public:
+    explicit LowerNameReader(std::string_view name) : _itr(name.data()), _end(name.data() + name.size()),
+        _utf8(utf8::is_valid(_itr, _end)) { }
+
+    [[nodiscard]] bool IsEnd() const { return _itr == _end; }
+
+    uint32 Next()
+    {
+        if (!_utf8)
+        {
+            char c = *_itr++;
+            return (c >= 'A' && c <= 'Z') ? uint32(c + 'a' - 'A') : uint32(uint8(c));
+        }
+
+        uint32 codePoint = utf8::unchecked::next(_itr);
+        return codePoint <= 0xFFFF ? uint32(wcharToLower(wchar_t(codePoint))) : codePoint;
+    }
+
+private:
+    char const* _itr;
+    char const* _end;
+    bool _utf8;
+};
+
+/// Case insensitive hash and equality of the name store, transparent so lookups need no lowered copy of the name
+struct CharacterNameHash
+{
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view name) const
+    {
+        // FNV-1a
+        std::size_t hash = 14695981039346656037ULL;
+        for (LowerNameReader reader(name); !reader.IsEnd();)
+        {
+            hash ^= reader.Next();
+            hash *= 1099511628211ULL;
+        }
+
+        return hash;
+    }
+};
+
+struct CharacterNameEqual
+{
+    using is_transparent = void;
+
+    bool operator()(std::string_view left, std::string_view right) const
+    {
+        LowerNameReader leftReader(left), rightReader(right);
+        while (!leftReader.IsEnd() && !rightReader.IsEnd())
+            if (leftReader.Next() != rightReader.Next())
+                return false;
+
+        return leftReader.IsEnd() && rightReader.IsEnd();
+    }
+};
+
+#endif // CharacterNameHash_h__
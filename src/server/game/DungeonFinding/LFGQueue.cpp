@@ -35,6 +35,70 @@ namespace lfg
         joinTime(time_t(GameTime::GetGameTime().count())), lastRefreshTime(joinTime), tanks(LFG_TANKS_NEEDED),
         healers(LFG_HEALERS_NEEDED), dps(LFG_DPS_NEEDED) { }
 
+    void LfgMatchSummary::Add(LfgMatchSummary const& other)
+    {
+        dungeons &= other.dungeons;
+        for (std::size_t i = 0; i < roleCounts.size(); ++i)
+            roleCounts[i] += other.roleCounts[i];
+
+        players += other.players;
+        lfgGroups += other.lfgGroups;
+    }
+
+    bool LfgMatchSummary::CanMatch(LfgMatchSummary const& other) const
+    {
+        if (players + other.players > MAXGROUPSIZE || lfgGroups + other.lfgGroups > 1 || roleCounts[0] + other.roleCounts[0])
+            return false;
+
+        if ((dungeons & other.dungeons).none())
+            return false;
+
+        // members can be given one role each only if, for every combination of roles, the members limited
+        // to that combination fit in its slots (Hall's theorem), same answer as LFGMgr::CheckGroupRoles
+        for (uint8 roles = 1; roles < 8; ++roles)
+        {
+            uint32 slots = ((roles & 1) ? LFG_TANKS_NEEDED : 0) + ((roles & 2) ? LFG_HEALERS_NEEDED : 0) + ((roles & 4) ? LFG_DPS_NEEDED : 0);
+            uint32 members = 0;
+            for (uint8 memberRoles = 1; memberRoles < 8; ++memberRoles)
+                if ((memberRoles & roles) == memberRoles)
+                    members += roleCounts[memberRoles] + other.roleCounts[memberRoles];
+
+            if (members > slots)
+                return false;
+        }
+
+        return true;
+    }
+
+    LfgMatchSummary LFGQueue::BuildMatchSummary(ObjectGuid guid, LfgDungeonSet const& dungeons, LfgRolesMap const& rolesMap)
+    {
+        LfgMatchSummary summary;
+        for (uint32 dungeonId : dungeons)
+        {
+            auto itr = m_dungeonBits.find(dungeonId);
+            if (itr == m_dungeonBits.end())
+            {
+                if (m_dungeonBits.size() >= LFG_DUNGEON_MASK_BITS)
+                {
+                    // no bit left, only the exact check can tell
+                    summary.dungeons.set();
+                    continue;
+                }
+
+                itr = m_dungeonBits.emplace(dungeonId, uint32(m_dungeonBits.size())).first;
+            }
+
+            summary.dungeons.set(itr->second);
+        }
+
+        for (LfgRolesMap::const_iterator itr = rolesMap.begin(); itr != rolesMap.end(); ++itr)
+            ++summary.roleCounts[(itr->second >> 1) & 7];
+
+        summary.players = uint8(rolesMap.size());
+        summary.lfgGroups = sLFGMgr->IsLfgGroup(guid) ? 1 : 0;
+        return summary;
+    }
+
     void LFGQueue::AddToQueue(ObjectGuid guid, bool failedProposal)
     {
         LOG_DEBUG("lfg", "ADD AddToQueue: {}, failed proposal: {}", guid.ToString(), failedProposal ? 1 : 0);
@@ -108,7 +172,9 @@ namespace lfg
     void LFGQueue::AddQueueData(ObjectGuid guid, time_t joinTime, LfgDungeonSet const& dungeons, LfgRolesMap const& rolesMap)
     {
         LOG_DEBUG("lfg", "JOINED AddQueueData: {}", guid.ToString());
-        QueueDataStore[guid] = LfgQueueData(joinTime, dungeons, rolesMap);
+        LfgQueueData& queueData = QueueDataStore[guid];
+        queueData = LfgQueueData(joinTime, dungeons, rolesMap);
+        queueData.summary = BuildMatchSummary(guid, dungeons, rolesMap);
         AddToQueue(guid);
     }
 
@@ -168,10 +234,10 @@ namespace lfg
         }
     }
 
-    void LFGQueue::AddToCompatibles(Lfg5Guids const& key)
+    void LFGQueue::AddToCompatibles(Lfg5Guids const& key, LfgMatchSummary const& summary)
     {
         LOG_DEBUG("lfg", "COMPATIBLES ADD: {}", key.toString());
-        CompatibleTempList.push_back(key);
+        CompatibleTempList.emplace_back(key, summary);
     }
 
     uint8 LFGQueue::FindGroups()
@@ -208,7 +274,7 @@ namespace lfg
         // we have to take into account that FindNewGroups is called every X minutes if number of compatibles is low!
         // build set of already present compatibles for this guid
         std::set<Lfg5Guids> currentCompatibles;
-        for (Lfg5GuidsList::iterator it = CompatibleList.begin(); it != CompatibleList.end(); ++it)
+        for (LfgCompatibleContainer::iterator it = CompatibleList.begin(); it != CompatibleList.end(); ++it)
             if (it->hasGuid(newGuid))
             {
                 // unset roles here so they are not copied, restore after insertion
@@ -221,21 +287,33 @@ namespace lfg
         LfgCompatibility selfCompatibility = LFG_COMPATIBILITY_PENDING;
         if (currentCompatibles.empty())
         {
-            selfCompatibility = CheckCompatibility(Lfg5Guids(), newGuid, foundMask, foundCount, currentCompatibles);
+            selfCompatibility = CheckCompatibility(Lfg5Guids(), LfgMatchSummary(), newGuid, foundMask, foundCount, currentCompatibles);
             if (selfCompatibility != LFG_COMPATIBLES_WITH_LESS_PLAYERS) // group is already compatible (a party of 5 players)
                 return selfCompatibility;
         }
 
-        for (Lfg5GuidsList::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
+        // partial groups that can't take the new entrant are rejected by masks, without building the combination
+        LfgQueueDataContainer::const_iterator itNew = QueueDataStore.find(newGuid);
+        LfgMatchSummary const* newSummary = (itNew != QueueDataStore.end() && m_skipByMask) ? &itNew->second.summary : nullptr;
+
+        for (LfgCompatibleContainer::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
         {
-            Lfg5GuidsList::iterator itr = it++;
+            LfgCompatibleContainer::iterator itr = it++;
             if (itr->empty())
             {
                 LOG_DEBUG("lfg", "ERASE from CompatibleList");
                 CompatibleList.erase(itr);
                 continue;
             }
-            LfgCompatibility compatibility = CheckCompatibility(*itr, newGuid, foundMask, foundCount, currentCompatibles);
+
+            ++m_matchStats.checked;
+            if (newSummary && !itr->summary.CanMatch(*newSummary))
+            {
+                ++m_matchStats.skipped;
+                continue;
+            }
+
+            LfgCompatibility compatibility = CheckCompatibility(*itr, itr->summary, newGuid, foundMask, foundCount, currentCompatibles);
             if (compatibility == LFG_COMPATIBLES_MATCH)
                 return LFG_COMPATIBLES_MATCH;
             if ((foundMask & 0x3FFF3FFF3FFF3FFF) == 0x3FFF3FFF3FFF3FFF) // each combination of dps+heal+tank already found 4 times
@@ -245,7 +323,7 @@ namespace lfg
         return selfCompatibility;
     }
 
-    LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, const ObjectGuid& newGuid, uint64& foundMask, uint32& foundCount, const std::set<Lfg5Guids>& currentCompatibles)
+    LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, LfgMatchSummary const& checkWithSummary, const ObjectGuid& newGuid, uint64& foundMask, uint32& foundCount, const std::set<Lfg5Guids>& currentCompatibles)
     {
         LOG_DEBUG("lfg", "CHECK CheckCompatibility: {}, new guid: {}", checkWith.toString(), newGuid.ToString());
         Lfg5Guids check(checkWith, false); // here newGuid is at front
@@ -303,7 +381,7 @@ namespace lfg
             strGuids.addRoles(roles);
             itQueue->second.bestCompatible.clear(); // this may be left after a failed proposal (not cleared, because UpdateQueueTimers would try to generate it with every update)
             //UpdateBestCompatibleInQueue(itQueue, strGuids);
-            AddToCompatibles(strGuids);
+            AddToCompatibles(strGuids, itQueue->second.summary);
             if (roleCheckResult && roleCheckResult <= 15)
                 foundMask |= ( (((uint64)1) << (roleCheckResult - 1)) | (((uint64)1) << (16 + roleCheckResult - 1)) | (((uint64)1) << (32 + roleCheckResult - 1)) | (((uint64)1) << (48 + roleCheckResult - 1)) );
             return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
@@ -401,7 +479,12 @@ namespace lfg
                 if (!itr->second.bestCompatible.empty()) // update if groups don't have it empty (for empty it will be generated in UpdateQueueTimers)
                     UpdateBestCompatibleInQueue(itr, strGuids);
             }
-            AddToCompatibles(strGuids);
+
+            LfgMatchSummary summary = QueueDataStore[newGuid].summary;
+            if (!checkWith.empty())
+                summary.Add(checkWithSummary);
+
+            AddToCompatibles(strGuids, summary);
             foundMask |= addToFoundMask;
             ++foundCount;
             return LFG_COMPATIBLES_WITH_LESS_PLAYERS;
@@ -410,6 +493,15 @@ namespace lfg
         proposal.queues = strGuids;
         proposal.isNew = numLfgGroups != 1;
 
+        if (m_dryRun)
+        {
+            ++m_matchStats.matched;
+            for (uint8 i = 0; i < 5 && proposal.queues.guids[i]; ++i)
+                RemoveFromQueue(proposal.queues.guids[i]);
+
+            return LFG_COMPATIBLES_MATCH;
+        }
+
         if (!sLFGMgr->AllQueued(check)) // can't create proposal
             return LFG_COMPATIBILITY_PENDING;
 
@@ -487,9 +579,9 @@ namespace lfg
             m_QueueStatusTimer += diff;
 
         LOG_DEBUG("lfg", "UPDATE UpdateQueueTimers");
-        for (Lfg5GuidsList::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
+        for (LfgCompatibleContainer::iterator it = CompatibleList.begin(); it != CompatibleList.end(); )
         {
-            Lfg5GuidsList::iterator itr = it++;
+            LfgCompatibleContainer::iterator itr = it++;
             if (itr->empty())
             {
                 LOG_DEBUG("lfg", "UpdateQueueTimers ERASE compatible");
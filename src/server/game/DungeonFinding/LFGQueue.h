@@ -18,6 +18,8 @@
 #ifndef _LFGQUEUE_H
 #define _LFGQUEUE_H
 
+#include <bitset>
+#include <unordered_map>
 #include <utility>
 
 #include "LFG.h"
@@ -37,6 +39,23 @@ namespace lfg
         LFG_COMPATIBLES_MATCH                                  // Must be the last one
     };
 
+    // Every dungeon seen by a queue gets one bit, dungeons of queued entries are intersected as masks
+    constexpr uint32 LFG_DUNGEON_MASK_BITS = 512;
+    typedef std::bitset<LFG_DUNGEON_MASK_BITS> LfgDungeonMask;
+
+    // What the matcher needs to know about a queued entry or a partial group without looking at its members again
+    struct LfgMatchSummary
+    {
+        LfgDungeonMask dungeons;
+        std::array<uint8, 8> roleCounts = { };                 // members per role combination, indexed by (roles >> 1) & 7
+        uint8 players = 0;
+        uint8 lfgGroups = 0;
+
+        void Add(LfgMatchSummary const& other);
+        // false when a group of both can never be formed (too many players, no common dungeon, roles that can't be filled)
+        [[nodiscard]] bool CanMatch(LfgMatchSummary const& other) const;
+    };
+
     // Stores player or group queue info
     struct LfgQueueData
     {
@@ -55,6 +74,7 @@ namespace lfg
         LfgDungeonSet dungeons;                                // Selected Player/Group Dungeon/s
         LfgRolesMap roles;                                     // Selected Player Role/s
         Lfg5Guids bestCompatible;                              // Best compatible combination of people queued
+        LfgMatchSummary summary;                               // Dungeons and roles as masks, see LFGQueue::BuildMatchSummary
     };
 
     struct LfgWaitTime
@@ -64,9 +84,24 @@ namespace lfg
         uint32 number{0};                                      // Number of people used to get that wait time
     };
 
+    // Partial group that new entrants are checked against
+    struct LfgCompatible : public Lfg5Guids
+    {
+        LfgCompatible(Lfg5Guids const& guids, LfgMatchSummary const& _summary) : Lfg5Guids(guids), summary(_summary) { }
+
+        LfgMatchSummary summary;
+    };
+
+    struct LfgMatchStats
+    {
+        uint64 checked{0};                                     // partial groups a new entrant was compared with
+        uint64 skipped{0};                                     // of those, rejected by LfgMatchSummary::CanMatch alone
+        uint32 matched{0};                                     // full groups found in dry run mode
+    };
+
     typedef std::map<uint32, LfgWaitTime> LfgWaitTimesContainer;
     typedef std::map<ObjectGuid, LfgQueueData> LfgQueueDataContainer;
-    typedef std::list<Lfg5Guids> LfgCompatibleContainer;
+    typedef std::list<LfgCompatible> LfgCompatibleContainer;
 
     /**
         Stores all data related to queue
@@ -93,6 +128,10 @@ namespace lfg
         // Find new group
         uint8 FindGroups();
 
+        // Benchmark support: full groups are counted and leave the queue instead of creating proposals
+        void EnableDryRun(bool skipByMask) { m_dryRun = true; m_skipByMask = skipByMask; }
+        [[nodiscard]] LfgMatchStats const& GetMatchStats() const { return m_matchStats; }
+
     private:
         void SetQueueUpdateData(std::string const& strGuids, LfgRolesMap const& proposalRoles);
 
@@ -100,13 +139,15 @@ namespace lfg
         void RemoveFromNewQueue(ObjectGuid guid);
 
         void RemoveFromCompatibles(ObjectGuid guid);
-        void AddToCompatibles(Lfg5Guids const& key);
+        void AddToCompatibles(Lfg5Guids const& key, LfgMatchSummary const& summary);
+
+        LfgMatchSummary BuildMatchSummary(ObjectGuid guid, LfgDungeonSet const& dungeons, LfgRolesMap const& rolesMap);
 
         uint32 FindBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue);
         void UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, Lfg5Guids const& key);
 
         LfgCompatibility FindNewGroups(const ObjectGuid& newGuid);
-        LfgCompatibility CheckCompatibility(Lfg5Guids const& checkWith, const ObjectGuid& newGuid, uint64& foundMask, uint32& foundCount, const std::set<Lfg5Guids>& currentCompatibles);
+        LfgCompatibility CheckCompatibility(Lfg5Guids const& checkWith, LfgMatchSummary const& checkWithSummary, const ObjectGuid& newGuid, uint64& foundMask, uint32& foundCount, const std::set<Lfg5Guids>& currentCompatibles);
 
         // Queue
         uint32 m_QueueStatusTimer;                         // used to check interval of sending queue status
@@ -120,6 +161,11 @@ namespace lfg
         LfgWaitTimesContainer waitTimesDpsStore;           // Average wait time to find a group queuing as dps
         LfgGuidList newToQueueStore;                       // New groups to add to queue
         LfgGuidList restoredAfterProposal;
+
+        std::unordered_map<uint32, uint32> m_dungeonBits;  // dungeon id -> bit in LfgDungeonMask
+        LfgMatchStats m_matchStats;
+        bool m_dryRun{false};
+        bool m_skipByMask{true};
     };
 }
 
@@ -29,7 +29,7 @@
 
 namespace lfg
 {
-    LFGPlayerScript::LFGPlayerScript() : PlayerScript("LFGPlayerScript") { }
+    LFGPlayerScript::LFGPlayerScript() : PlayerScript("LFGPlayerScript", { }) { }
 
     void LFGPlayerScript::OnLevelChanged(Player* player, uint8 /*oldLevel*/)
     {
@@ -26,6 +26,7 @@
 #include "Player.h"
 #include "UpdateMask.h"
 #include "World.h"
+#include <bit>
 
 Corpse::Corpse(CorpseType type) : WorldObject(type != CORPSE_BONES), m_type(type)
 {
@@ -210,11 +211,14 @@ void Corpse::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targe
     uint32* flags = nullptr;
     uint32 visibleFlag = GetUpdateFieldData(target, flags);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    for (uint32 block = 0; block < updateMask.GetBlockCount(); ++block)
     {
-        if (_fieldNotifyFlags & flags[index] || ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)))
+        uint32 fields = GetUpdateFieldsInBlock(updateType, flags, visibleFlag, block);
+        updateMask.SetBlock(block, fields);
+
+        for (; fields; fields &= fields - 1)
         {
-            updateMask.SetBit(index);
+            uint16 index = block * UpdateMask::CLIENT_UPDATE_MASK_BITS + std::countr_zero(fields);
 
             if (index == CORPSE_FIELD_BYTES_1 || index == CORPSE_FIELD_BYTES_2)
             {
@@ -221,7 +221,7 @@ bool TemporaryThreatModifierEvent::Execute(uint64 /*e_time*/, uint32 /*p_time*/)
 }
 
 Creature::Creature(bool isWorldObject): Unit(isWorldObject), MovableMapObject(), m_groupLootTimer(0), lootingGroupLowGUID(0), m_lootRecipientGroup(0),
-    m_corpseRemoveTime(0), m_respawnTime(0), m_respawnDelay(300), m_corpseDelay(60), m_wanderDistance(0.0f), m_boundaryCheckTime(2500),
+    m_corpseRemoveTime(0), m_respawnTime(0), m_respawnQueueTime(0), m_respawnQueuedFor(0), m_sleepTimer(0), m_sleptTime(0), m_respawnDelay(300), m_corpseDelay(60), m_wanderDistance(0.0f), m_boundaryCheckTime(2500),
     m_transportCheckTimer(1000), lootPickPocketRestoreTime(0), m_combatPulseTime(0), m_combatPulseDelay(0), m_reactState(REACT_AGGRESSIVE), m_defaultMovementType(IDLE_MOTION_TYPE),
     m_spawnId(0), m_equipmentId(0), m_originalEquipmentId(0), m_AlreadyCallAssistance(false),
     m_AlreadySearchedAssistance(false), m_regenHealth(true), m_regenPower(true), m_AI_locked(false), m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL), m_originalEntry(0), m_moveInLineOfSightDisabled(false), m_moveInLineOfSightStrictlyDisabled(false),
@@ -695,6 +695,10 @@ void Creature::Update(uint32 diff)
                     SaveRespawnTime(); // also save to DB immediately
                 }
             }
+
+            // not respawned yet, spawns sleep until the map's respawn queue wakes them
+            if (m_deathState == DEAD && m_spawnId && !IsSummon() && !IsWaitingForRespawn())
+                GetMap()->ScheduleRespawn(this);
             break;
         }
         case CORPSE:
@@ -1829,6 +1833,7 @@ bool Creature::LoadCreatureFromDB(ObjectGuid::LowType spawnId, Map* map, bool ad
     if (m_respawnTime)                          // respawn on Update
     {
         m_deathState = DEAD;
+        map->ScheduleRespawn(this);
         if (CanFly())
         {
             float tz = map->GetHeight(GetPhaseMask(), data->posX, data->posY, data->posZ, true, MAX_FALL_DISTANCE);
@@ -2673,6 +2678,80 @@ void Creature::UpdateMoveInLineOfSightState()
         m_moveInLineOfSightDisabled = false;
 }
 
+bool Creature::Sleep(uint32& diff)
+{
+    if (m_sleepTimer)
+    {
+        m_sleptTime += diff;
+        if (m_sleptTime < m_sleepTimer && IsIdle())
+            return true;
+
+        diff = m_sleptTime;
+        m_sleepTimer = 0;
+    }
+    else
+        diff += m_sleptTime;                            // woken up by WakeUp()
+
+    m_sleptTime = 0;
+
+    if (uint32 interval = sWorld->getIntConfig(CONFIG_CREATURE_IDLE_UPDATE_INTERVAL))
+        if (CanSleep())
+            m_sleepTimer = interval;
+
+    return false;
+}
+
+bool Creature::CanSleep() const
+{
+    // pets, summons, bots and passengers follow someone else, instance scripts rely on exact timers
+    if (IsPet() || IsSummon() || IsNPCBotOrPet() || GetOwnerGUID() || GetCharmerGUID() || GetVehicle() || GetTransport() ||
+        isActiveObject() || GetMap()->Instanceable())
+        return false;
+
+    if (!IsIdle())
+        return false;
+
+    // timed and periodic auras are updated by Unit::Update, new auras wake us up in Unit::_AddAura
+    for (auto const& [spellId, aura] : GetOwnedAuras())
+    {
+        if (!aura->IsPermanent())
+            return false;
+
+        for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+            if (AuraEffect const* effect = aura->GetEffect(i))
+                if (effect->IsPeriodic())
+                    return false;
+    }
+
+    return true;
+}
+
+// checked on every skipped update, keep it cheap
+bool Creature::IsIdle() const
+{
+    if (!IsAlive() || IsInCombat() || IsInEvadeMode() || TriggerJustRespawned || NeedChangeAI || m_Events.HasEvents())
+        return false;
+
+    if (HasUnitState(UNIT_STATE_CASTING) || !movespline->Finalized())
+        return false;
+
+    // random and waypoint movement only wait for their next move
+    switch (GetMotionMaster()->GetCurrentMovementGeneratorType())
+    {
+        case IDLE_MOTION_TYPE:
+        case RANDOM_MOTION_TYPE:
+        case WAYPOINT_MOTION_TYPE:
+            break;
+        default:
+            return false;
+    }
+
+    // regeneration, rage and runic power decay
+    Powers power = getPowerType();
+    bool powerIdle = (power == POWER_RAGE || power == POWER_RUNIC_POWER) ? !GetPower(power) : GetPower(power) == GetMaxPower(power);
+    return powerIdle && GetHealth() == GetMaxHealth();
+}
+
 void Creature::SaveRespawnTime()
 {
     if (IsSummon() || !m_spawnId || (m_creatureData && !m_creatureData->dbData))
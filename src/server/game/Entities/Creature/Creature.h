@@ -292,6 +292,17 @@ public:
     void Respawn(bool force = false);
     void SaveRespawnTime() override;
 
+    // dead creatures wait in the map's respawn queue instead of being updated by their grid, see Map::ScheduleRespawn
+    [[nodiscard]] bool IsWaitingForRespawn() const { return m_deathState == DEAD && m_respawnQueueTime && m_respawnTime >= m_respawnQueuedFor; }
+    [[nodiscard]] time_t GetRespawnQueueTime() const { return m_respawnQueueTime; }
+    void SetRespawnQueueTime(time_t queueTime) { m_respawnQueueTime = queueTime; m_respawnQueuedFor = m_respawnTime; }
+
+    // idle creatures are updated once per Creature.IdleUpdateInterval, true if this update is skipped,
+    // otherwise diff is increased by the time slept through
+    bool Sleep(uint32& diff);
+    void WakeUp() { m_sleepTimer = 0; }
+    [[nodiscard]] bool IsSleeping() const { return m_sleepTimer != 0; }
+
     [[nodiscard]] uint32 GetRespawnDelay() const { return m_respawnDelay; }
     void SetRespawnDelay(uint32 delay) { m_respawnDelay = delay; }
 
@@ -493,6 +504,10 @@ protected:
     /// Timers
     time_t m_corpseRemoveTime;                          // (secs) timer for death or corpse disappearance
     time_t m_respawnTime;                               // (secs) time of next respawn
+    time_t m_respawnQueueTime;                          // (secs) when the map's respawn queue wakes this creature, 0 if not queued
+    time_t m_respawnQueuedFor;                          // m_respawnTime when it was queued, an earlier respawn is polled by Update again
+    uint32 m_sleepTimer;                                // (msecs) update interval while idle, 0 when awake
+    uint32 m_sleptTime;                                 // (msecs) skipped diff, passed to the next Update
     time_t m_respawnedTime;                             // (secs) time when creature respawned
     uint32 m_respawnDelay;                              // (secs) delay between corpse disappearance and respawning
     uint32 m_corpseDelay;                               // (secs) delay between death and corpse disappearance
@@ -548,6 +563,9 @@ private:
 
     [[nodiscard]] bool CanPeriodicallyCallForAssistance() const;
 
+    [[nodiscard]] bool CanSleep() const;
+    [[nodiscard]] bool IsIdle() const;
+
     //WaypointMovementGenerator vars
     uint32 m_waypointID;
     uint32 m_path_id;
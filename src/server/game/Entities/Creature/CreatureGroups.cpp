@@ -19,8 +19,10 @@
 #include "Creature.h"
 #include "CreatureAI.h"
 #include "Log.h"
+#include "MoveSpline.h"
 #include "MoveSplineInit.h"
 #include "ObjectMgr.h"
+#include "World.h"
 
 FormationMgr::~FormationMgr()
 {
@@ -175,7 +177,13 @@ void CreatureGroup::AddMember(Creature* member)
         m_leader = member;
     }
 
-    m_members[member] = sFormationMgr->CreatureGroupMap.find(member->GetSpawnId())->second;
+    FormationInfo const& info = sFormationMgr->CreatureGroupMap.find(member->GetSpawnId())->second;
+    auto itr = std::find_if(m_members.begin(), m_members.end(), [member](auto const& pair) { return pair.first == member; });
+    if (itr != m_members.end())
+        itr->second = info;
+    else
+        m_members.emplace_back(member, info);
+
     member->SetFormation(this);
 }
 
@@ -186,13 +194,26 @@ void CreatureGroup::RemoveMember(Creature* member)
         m_leader = nullptr;
     }
 
-    m_members.erase(member);
+    auto itr = std::find_if(m_members.begin(), m_members.end(), [member](auto const& pair) { return pair.first == member; });
+    if (itr != m_members.end())
+        m_members.erase(itr);
+
     member->SetFormation(nullptr);
 }
 
+FormationInfo const* CreatureGroup::GetMemberInfo(Creature const* member) const
+{
+    for (auto const& itr : m_members)
+        if (itr.first == member)
+            return &itr.second;
+
+    return nullptr;
+}
+
 void CreatureGroup::MemberEngagingTarget(Creature* member, Unit* target)
 {
-    uint8 const groupAI = sFormationMgr->CreatureGroupMap[member->GetSpawnId()].groupAI;
+    FormationInfo const* memberInfo = GetMemberInfo(member);
+    uint8 const groupAI = memberInfo ? memberInfo->groupAI : 0;
     if (member == m_leader)
     {
         if (!(groupAI & std::underlying_type_t<GroupAIFlags>(GroupAIFlags::GROUP_AI_FLAG_MEMBER_ASSIST_LEADER)))
@@ -232,7 +253,8 @@ void CreatureGroup::MemberEngagingTarget(Creature* member, Unit* target)
 
 Unit* CreatureGroup::GetNewTargetForMember(Creature* member)
 {
-    uint8 const groupAI = sFormationMgr->CreatureGroupMap[member->GetSpawnId()].groupAI;
+    FormationInfo const* memberInfo = GetMemberInfo(member);
+    uint8 const groupAI = memberInfo ? memberInfo->groupAI : 0;
     if (!(groupAI & std::underlying_type_t<GroupAIFlags>(GroupAIFlags::GROUP_AI_FLAG_ACQUIRE_NEW_TARGET_ON_EVADE)))
     {
         return nullptr;
@@ -279,7 +301,8 @@ Unit* CreatureGroup::GetNewTargetForMember(Creature* member)
 
 void CreatureGroup::MemberEvaded(Creature* member)
 {
-    uint8 const groupAI = sFormationMgr->CreatureGroupMap[member->GetSpawnId()].groupAI;
+    FormationInfo const* memberInfo = GetMemberInfo(member);
+    uint8 const groupAI = memberInfo ? memberInfo->groupAI : 0;
     if (!(groupAI & std::underlying_type_t<GroupAIFlags>(GroupAIFlags::GROUP_AI_FLAG_EVADE_MASK)))
     {
         return;
@@ -363,14 +386,18 @@ void CreatureGroup::FormationReset(bool dismiss, bool initMotionMaster)
 void CreatureGroup::LeaderMoveTo(float x, float y, float z, bool run)
 {
     //! To do: This should probably get its own movement generator or use WaypointMovementGenerator.
-    //! If the leader's path is known, member's path can be plotted as well using formation offsets.
+    //! Members on the ground replay the leader's path moved by their formation offset, see GetLeaderPath.
     if (!m_leader)
     {
         return;
     }
 
+    // members start moving together, their monster move packets are sent with one grid visit
+    Movement::MonsterMoveBatch moveBatch(m_leader);
+
     float pathDist = m_leader->GetExactDist(x, y, z);
     float pathAngle = std::atan2(m_leader->GetPositionY() - y, m_leader->GetPositionX() - x);
+    Movement::PointsArray const leaderPath = GetLeaderPath(x, y);
 
     for (auto const& itr : m_members)
     {
@@ -427,12 +454,54 @@ void CreatureGroup::LeaderMoveTo(float x, float y, float z, bool run)
         if (speedRate > 0.01f) // don't move if speed rate is too low
         {
             member->SetSpeedRate(mtype, speedRate);
-            member->GetMotionMaster()->MovePoint(0, dx, dy, dz);
+            // the shared path is snapped to the ground, flying and swimming members path on their own
+            if (!leaderPath.empty() && !member->CanFly() && !member->IsInWater())
+            {
+                // leader's path moved by the member's offset from the leader's destination
+                Movement::PointsArray path;
+                path.reserve(leaderPath.size());
+                path.emplace_back(member->GetPositionX(), member->GetPositionY(), member->GetPositionZ());
+                for (std::size_t i = 1; i + 1 < leaderPath.size(); ++i)
+                {
+                    float px = leaderPath[i].x + dx - x;
+                    float py = leaderPath[i].y + dy - y;
+                    float pz = leaderPath[i].z;
+                    Acore::NormalizeMapCoord(px);
+                    Acore::NormalizeMapCoord(py);
+                    member->UpdateGroundPositionZ(px, py, pz);
+                    path.emplace_back(px, py, pz);
+                }
+                path.emplace_back(dx, dy, dz);
+
+                member->GetMotionMaster()->MovePoint(0, path);
+            }
+            else
+                member->GetMotionMaster()->MovePoint(0, dx, dy, dz);
             member->SetHomePosition(dx, dy, dz, pathAngle);
         }
     }
 }
 
+Movement::PointsArray CreatureGroup::GetLeaderPath(float x, float y) const
+{
+    Movement::PointsArray path;
+    if (!sWorld->getBoolConfig(CONFIG_FORMATION_SHARED_PATH) || m_leader->GetTransport())
+        return path;
+
+    // LeaderMoveTo is called right after the leader launched its move to x, y, z
+    Movement::MoveSpline const* moveSpline = m_leader->movespline;
+    if (moveSpline->Finalized() || moveSpline->onTransport || moveSpline->isCyclic() || (moveSpline->FinalDestination().xy() - G3D::Vector2(x, y)).squaredLength() > 1.0f)
+        return path;
+
+    // control points without the virtual ones, see SplineBase::InitCatmullRom
+    Movement::MoveSpline::MySpline const& spline = moveSpline->_Spline();
+    path.reserve(spline.last() - spline.first() + 1);
+    for (int32 i = spline.first(); i <= spline.last(); ++i)
+        path.push_back(spline.getPoint(i));
+
+    return path;
+}
+
 void CreatureGroup::RespawnFormation(bool force)
 {
     for (auto const& itr : m_members)
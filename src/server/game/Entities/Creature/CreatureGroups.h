@@ -20,8 +20,8 @@
 
 #include "Define.h"
 #include "Unit.h"
-#include <map>
 #include <unordered_map>
+#include <vector>
 
 class Creature;
 class CreatureGroup;
@@ -89,7 +89,8 @@ class CreatureGroup
 {
 public:
     // pussywizard: moved public to the top so it compiles and typedef is public
-    typedef std::map<Creature*, FormationInfo>  CreatureGroupMemberType;
+    // formations have a handful of members, walked on every leader move, a flat array beats any lookup structure
+    typedef std::vector<std::pair<Creature*, FormationInfo>> CreatureGroupMemberType;
 
     //Group cannot be created empty
     explicit CreatureGroup(uint32 id) : m_leader(nullptr), m_groupID(id), m_Formed(false) {}
@@ -116,6 +117,10 @@ public:
     [[nodiscard]] bool IsAnyMemberAlive(bool ignoreLeader = false);
 
 private:
+    [[nodiscard]] FormationInfo const* GetMemberInfo(Creature const* member) const;
+    // leader's just launched path, empty if members have to calculate their own
+    [[nodiscard]] Movement::PointsArray GetLeaderPath(float x, float y) const;
+
     Creature* m_leader; //Important do not forget sometimes to work with pointers instead synonims :D:D
     CreatureGroupMemberType m_members;
 
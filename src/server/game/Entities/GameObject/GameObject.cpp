@@ -38,6 +38,7 @@
 #include <G3D/Box.h>
 #include <G3D/CoordinateFrame.h>
 #include <G3D/Quat.h>
+#include <bit>
 
 GameObject::GameObject() : WorldObject(false), MovableMapObject(),
     m_model(nullptr), m_goValue(), m_AI(nullptr)
@@ -49,6 +50,8 @@ GameObject::GameObject() : WorldObject(false), MovableMapObject(),
 
     m_valuesCount = GAMEOBJECT_END;
     m_respawnTime = 0;
+    m_respawnQueueTime = 0;
+    m_respawnQueuedFor = 0;
     m_respawnDelayTime = 300;
     m_despawnDelay = 0;
     m_despawnRespawnTime = 0s;
@@ -623,6 +626,7 @@ void GameObject::Update(uint32 diff)
                         }
 
                         m_respawnTime = 0;
+                        InvalidateCachedVisibility(); // spawned again
                         m_SkillupList.clear();
                         m_usetimes = 0;
 
@@ -674,6 +678,9 @@ void GameObject::Update(uint32 diff)
                         else
                             GetMap()->AddToMap(this);
                     }
+                    // still despawned, sleep until the map's respawn queue wakes us
+                    else if (m_spawnedByDefault && m_spawnId && !IsWaitingForRespawn())
+                        GetMap()->ScheduleRespawn(this);
                 }
 
                 if (isSpawned())
@@ -1166,6 +1173,8 @@ bool GameObject::LoadGameObjectFromDB(ObjectGuid::LowType spawnId, Map* map, boo
                 m_respawnTime = 0;
                 GetMap()->RemoveGORespawnTime(m_spawnId);
             }
+            else if (m_respawnTime)
+                GetMap()->ScheduleRespawn(this);
         }
     }
     else
@@ -1303,6 +1312,7 @@ void GameObject::SetRespawnTime(int32 respawn)
 {
     m_respawnTime = respawn > 0 ? GameTime::GetGameTime().count() + respawn : 0;
     SetRespawnDelay(respawn);
+    InvalidateCachedVisibility(); // isSpawned() depends on both
     if (respawn && !m_spawnedByDefault)
     {
         UpdateObjectVisibility(true);
@@ -1319,6 +1329,7 @@ void GameObject::Respawn()
     if (m_spawnedByDefault && m_respawnTime > 0)
     {
         m_respawnTime = GameTime::GetGameTime().count();
+        InvalidateCachedVisibility();
         GetMap()->RemoveGORespawnTime(m_spawnId);
     }
 }
@@ -2801,13 +2812,17 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* t
     if (GetOwnerGUID() == target->GetGUID())
         visibleFlag |= UF_FLAG_OWNER;
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    for (uint32 block = 0; block < updateMask.GetBlockCount(); ++block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-                ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)) ||
-                (index == GAMEOBJECT_FLAGS && forcedFlags))
+        uint32 fields = GetUpdateFieldsInBlock(updateType, flags, visibleFlag, block);
+        if (forcedFlags && block == UpdateMask::GetBlockIndex(GAMEOBJECT_FLAGS))
+            fields |= UpdateMask::GetBlockBit(GAMEOBJECT_FLAGS);
+
+        updateMask.SetBlock(block, fields);
+
+        for (; fields; fields &= fields - 1)
         {
-            updateMask.SetBit(index);
+            uint16 index = block * UpdateMask::CLIENT_UPDATE_MASK_BITS + std::countr_zero(fields);
 
             if (index == GAMEOBJECT_DYNAMIC)
             {
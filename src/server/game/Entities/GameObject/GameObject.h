@@ -198,6 +198,11 @@ public:
                (m_respawnTime == 0 && m_spawnedByDefault);
     }
     [[nodiscard]] bool isSpawnedByDefault() const { return m_spawnedByDefault; }
+
+    // despawned spawns wait in the map's respawn queue instead of being updated by their grid, see Map::ScheduleRespawn
+    [[nodiscard]] bool IsWaitingForRespawn() const { return m_spawnedByDefault && m_lootState == GO_READY && m_respawnQueueTime && m_respawnTime >= m_respawnQueuedFor; }
+    [[nodiscard]] time_t GetRespawnQueueTime() const { return m_respawnQueueTime; }
+    void SetRespawnQueueTime(time_t queueTime) { m_respawnQueueTime = queueTime; m_respawnQueuedFor = m_respawnTime; }
     void SetSpawnedByDefault(bool b) { m_spawnedByDefault = b; }
     [[nodiscard]] uint32 GetRespawnDelay() const { return m_respawnDelayTime; }
     void Refresh();
@@ -380,6 +385,8 @@ protected:
     void UpdateModel();                                 // updates model in case displayId were changed
     uint32      m_spellId;
     time_t      m_respawnTime;                          // (secs) time of next respawn (or despawn if GO have owner()),
+    time_t      m_respawnQueueTime;                     // (secs) when the map's respawn queue wakes this object, 0 if not queued
+    time_t      m_respawnQueuedFor;                     // m_respawnTime when it was queued, an earlier respawn is polled by Update again
     uint32      m_respawnDelayTime;                     // (secs) if 0 then current GO state no dependent from timer
     uint32      m_despawnDelay;
     Seconds     m_despawnRespawnTime;                   // override respawn time after delayed despawn
@@ -51,6 +51,7 @@
 #include "WorldPacket.h"
 #include "Tokenize.h"
 #include "StringConvert.h"
+#include <bit>
 
 /// @todo: this import is not necessary for compilation and marked as unused by the IDE
 //  however, for some reasons removing it would cause a damn linking issue
@@ -506,14 +507,13 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targe
     uint32* flags = nullptr;
     uint32 visibleFlag = GetUpdateFieldData(target, flags);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    for (uint32 block = 0; block < updateMask.GetBlockCount(); ++block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-                ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)))
-        {
-            updateMask.SetBit(index);
-            fieldBuffer << m_uint32Values[index];
-        }
+        uint32 fields = GetUpdateFieldsInBlock(updateType, flags, visibleFlag, block);
+        updateMask.SetBlock(block, fields);
+
+        for (; fields; fields &= fields - 1)
+            fieldBuffer << m_uint32Values[block * UpdateMask::CLIENT_UPDATE_MASK_BITS + std::countr_zero(fields)];
     }
 
     *data << uint8(updateMask.GetBlockCount());
@@ -521,6 +521,37 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targe
     data->append(fieldBuffer);
 }
 
+uint32 Object::GetUpdateFieldsInBlock(uint8 updateType, uint32 const* flags, uint32 visibleFlag, uint32 block) const
+{
+    uint32 const firstIndex = block * UpdateMask::CLIENT_UPDATE_MASK_BITS;
+    if (firstIndex >= m_valuesCount)
+        return 0;
+
+    uint32 visibleFields = GetUpdateFieldFlagsBlock(flags, visibleFlag, block);
+    uint32 fields = 0;
+    if (updateType == UPDATETYPE_VALUES)
+        fields = _changesMask.GetBlock(block) & visibleFields;
+    else
+    {
+        // create blocks send every visible field that is set
+        for (; visibleFields; visibleFields &= visibleFields - 1)
+        {
+            uint32 bit = std::countr_zero(visibleFields);
+            if (firstIndex + bit < m_valuesCount && m_uint32Values[firstIndex + bit])
+                fields |= uint32(1) << bit;
+        }
+    }
+
+    fields |= GetUpdateFieldFlagsBlock(flags, _fieldNotifyFlags, block);
+
+    // flag tables are sized for the largest type sharing them (containers, players)
+    uint32 const fieldsInBlock = m_valuesCount - firstIndex;
+    if (fieldsInBlock < UpdateMask::CLIENT_UPDATE_MASK_BITS)
+        fields &= (uint32(1) << fieldsInBlock) - 1;
+
+    return fields;
+}
+
 void Object::AddToObjectUpdateIfNeeded()
 {
     if (m_inWorld && !m_objectUpdated)
@@ -2874,6 +2905,7 @@ void WorldObject::SetPhaseMask(uint32 newPhaseMask, bool update)
 {
     sScriptMgr->OnBeforeWorldObjectSetPhaseMask(this, m_phaseMask, newPhaseMask, m_useCombinedPhases, update);
     m_phaseMask = newPhaseMask;
+    InvalidateCachedVisibility();
 
     if (update && IsInWorld())
         UpdateObjectVisibility();
@@ -2912,6 +2944,9 @@ void WorldObject::DestroyForNearbyPlayers()
     if (!IsInWorld())
         return;
 
+    // despawns, the players' cached "can see" must not send the object again
+    InvalidateCachedVisibility();
+
     std::list<Player*> targets;
     Acore::AnyPlayerInObjectRangeCheck check(this, GetVisibilityRange() + VISIBILITY_COMPENSATION, false);
     Acore::PlayerListSearcherWithSharedVision<Acore::AnyPlayerInObjectRangeCheck> searcher(this, targets, check);
@@ -2936,6 +2971,8 @@ void WorldObject::DestroyForNearbyPlayers()
 
 void WorldObject::UpdateObjectVisibility(bool /*forced*/, bool /*fromUpdate*/)
 {
+    InvalidateCachedVisibility();
+
     //updates object's visibility for nearby players
     Acore::VisibleChangesNotifier notifier(*this);
     Cell::VisitWorldObjects(this, notifier, GetVisibilityRange());
@@ -227,6 +227,8 @@ protected:
     bool _LoadIntoDataField(std::string const& data, uint32 startOffset, uint32 count);
 
     uint32 GetUpdateFieldData(Player const* target, uint32*& flags) const;
+    // fields of one 32 field block of the update mask that have to be sent to a viewer of the given visibility
+    [[nodiscard]] uint32 GetUpdateFieldsInBlock(uint8 updateType, uint32 const* flags, uint32 visibleFlag, uint32 block) const;
 
     void BuildMovementUpdate(ByteBuffer* data, uint16 flags) const;
     virtual void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player* target) const;
@@ -506,6 +508,10 @@ public:
     //bool CanSeeOrDetect(WorldObject const* obj, bool ignoreStealth = false, bool distanceCheck = false) const;
     bool CanSeeOrDetect(WorldObject const* obj, bool ignoreStealth = false, bool distanceCheck = false, bool checkAlert = false) const;
 
+    // changes whenever something CanSeeOrDetect depends on may have changed, results cached in VisibilityCache are then dropped
+    [[nodiscard]] uint32 GetVisibilityStamp() const { return m_visibilityStamp; }
+    void InvalidateCachedVisibility() { ++m_visibilityStamp; }
+
     FlaggedValuesArray32<int32, uint32, StealthType, TOTAL_STEALTH_TYPES> m_stealth;
     FlaggedValuesArray32<int32, uint32, StealthType, TOTAL_STEALTH_TYPES> m_stealthDetect;
 
@@ -669,6 +675,7 @@ private:
 
     uint16 m_notifyflags;
     uint16 m_executed_notifies;
+    uint32 m_visibilityStamp{0};
 
     virtual bool _IsWithinDist(WorldObject const* obj, float dist2compare, bool is3D, bool useBoundingRadius = true) const;
 
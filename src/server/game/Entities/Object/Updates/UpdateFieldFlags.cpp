@@ -16,6 +16,10 @@
  */
 
 #include "UpdateFieldFlags.h"
+#include "Errors.h"
+#include <array>
+#include <bit>
+#include <vector>
 
 uint32 ItemUpdateFieldFlags[CONTAINER_END] =
 {
@@ -1566,3 +1570,58 @@ uint32 CorpseUpdateFieldFlags[CORPSE_END] =
     UF_FLAG_DYNAMIC,                                        // CORPSE_FIELD_DYNAMIC_FLAGS
     UF_FLAG_NONE,                                           // CORPSE_FIELD_PAD
 };
+
+namespace
+{
+    constexpr uint32 UF_FLAG_BIT_COUNT = 9;
+    constexpr uint32 UF_FIELDS_PER_BLOCK = 32;
+
+    /// Per 32 field block, the fields carrying each individual flag bit
+    class UpdateFieldFlagMasks
+    {
+    public:
+        UpdateFieldFlagMasks(uint32 const* flags, uint32 count) : _flags(flags), _blocks((count + UF_FIELDS_PER_BLOCK - 1) / UF_FIELDS_PER_BLOCK)
+        {
+            for (uint32 index = 0; index < count; ++index)
+                for (uint32 bit = 0; bit < UF_FLAG_BIT_COUNT; ++bit)
+                    if (flags[index] & (1 << bit))
+                        _blocks[index / UF_FIELDS_PER_BLOCK][bit] |= uint32(1) << (index % UF_FIELDS_PER_BLOCK);
+        }
+
+        bool IsFor(uint32 const* flags) const { return _flags == flags; }
+
+        uint32 GetBlock(uint32 flagMask, uint32 block) const
+        {
+            if (block >= _blocks.size())
+                return 0;
+
+            uint32 fields = 0;
+            for (uint32 bits = flagMask & ((1 << UF_FLAG_BIT_COUNT) - 1); bits; bits &= bits - 1)
+                fields |= _blocks[block][std::countr_zero(bits)];
+
+            return fields;
+        }
+
+    private:
+        uint32 const* _flags;
+        std::vector<std::array<uint32, UF_FLAG_BIT_COUNT>> _blocks;
+    };
+}
+
+uint32 GetUpdateFieldFlagsBlock(uint32 const* flags, uint32 flagMask, uint32 block)
+{
+    static UpdateFieldFlagMasks const masks[] =
+    {
+        { ItemUpdateFieldFlags, CONTAINER_END },
+        { UnitUpdateFieldFlags, PLAYER_END },
+        { GameObjectUpdateFieldFlags, GAMEOBJECT_END },
+        { DynamicObjectUpdateFieldFlags, DYNAMICOBJECT_END },
+        { CorpseUpdateFieldFlags, CORPSE_END }
+    };
+
+    for (UpdateFieldFlagMasks const& mask : masks)
+        if (mask.IsFor(flags))
+            return mask.GetBlock(flagMask, block);
+
+    ABORT("Unknown update field flags table");
+}
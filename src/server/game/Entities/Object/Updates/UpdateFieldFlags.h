@@ -41,4 +41,8 @@ extern uint32 GameObjectUpdateFieldFlags[GAMEOBJECT_END];
 extern uint32 DynamicObjectUpdateFieldFlags[DYNAMICOBJECT_END];
 extern uint32 CorpseUpdateFieldFlags[CORPSE_END];
 
+/// Returns a bit for each of the 32 fields of `block` in the given flags table that has any of `flagMask` set.
+/// The table must be one of the update field flag tables above.
+uint32 GetUpdateFieldFlagsBlock(uint32 const* flags, uint32 flagMask, uint32 block);
+
 #endif // _UPDATEFIELDFLAGS_H
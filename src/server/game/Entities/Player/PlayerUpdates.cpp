@@ -1587,6 +1587,8 @@ void Player::UpdateObjectVisibility(bool forced, bool fromUpdate)
     if (!IsInWorld())
         return;
 
+    InvalidateCachedVisibility();
+
     if (!forced)
         AddToNotify(NOTIFY_VISIBILITY_CHANGED);
     else if (!isBeingLoaded())
@@ -1652,7 +1654,7 @@ void Player::UpdateVisibilityOf(T* target, UpdateData& data,
 {
     if (HaveAtClient(target))
     {
-        if (!CanSeeOrDetect(target, false, true))
+        if (!GetMap()->GetVisibilityCache().CanSeeOrDetect(this, target))
         {
             BeforeVisibilityDestroy<T>(target, this);
 
@@ -1662,7 +1664,7 @@ void Player::UpdateVisibilityOf(T* target, UpdateData& data,
     }
     else
     {
-        if (CanSeeOrDetect(target, false, true))
+        if (GetMap()->GetVisibilityCache().CanSeeOrDetect(this, target))
         {
             target->BuildCreateUpdateBlockForPlayer(&data, this);
             UpdateVisibilityOf_helper(m_clientGUIDs, target, visibleNow);
@@ -1685,7 +1687,7 @@ void Player::UpdateVisibilityOf(WorldObject* target)
 {
     if (HaveAtClient(target))
     {
-        if (!CanSeeOrDetect(target, false, true))
+        if (!GetMap()->GetVisibilityCache().CanSeeOrDetect(this, target))
         {
             if (target->GetTypeId() == TYPEID_UNIT)
                 BeforeVisibilityDestroy<Creature>(target->ToCreature(), this);
@@ -1696,7 +1698,7 @@ void Player::UpdateVisibilityOf(WorldObject* target)
     }
     else
     {
-        if (CanSeeOrDetect(target, false, true))
+        if (GetMap()->GetVisibilityCache().CanSeeOrDetect(this, target))
         {
             target->SendUpdateToPlayer(this);
             m_clientGUIDs.insert(target->GetGUID());
@@ -71,6 +71,7 @@
 #include "WorldPacket.h"
 #include "Tokenize.h"
 #include "StringConvert.h"
+#include <bit>
 #include <math.h>
 
 //npcbot
@@ -4595,6 +4596,11 @@ Aura* Unit::_TryStackingOrRefreshingExistingAura(SpellInfo const* newAura, uint8
 void Unit::_AddAura(UnitAura* aura, Unit* caster)
 {
     ASSERT(!m_cleanupDone);
+
+    // the aura may need timed updates
+    if (Creature* creature = ToCreature())
+        creature->WakeUp();
+
     m_ownedAuras.insert(AuraMap::value_type(aura->GetId(), aura));
 
     _RemoveNoStackAurasDueToAura(aura);
@@ -4692,6 +4698,8 @@ void Unit::_ApplyAura(AuraApplication* aurApp, uint8 effMask)
     if (aurApp->GetRemoveMode())
         return;
 
+    InvalidateCachedVisibility();
+
     Unit* caster = aura->GetCaster();
 
     // Update target aura state flag
@@ -4747,6 +4755,8 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMo
     Aura* aura = aurApp->GetBase();
     LOG_DEBUG("spells.aura", "Aura {} now is remove mode {}", aura->GetId(), removeMode);
 
+    InvalidateCachedVisibility();
+
     // dead loop is killing the server probably
     ASSERT(m_removedAurasCount < 0xFFFFFFFF);
 
@@ -15146,6 +15156,8 @@ void Unit::SetSpeed(UnitMoveType mtype, float rate, bool forced)
 
 void Unit::setDeathState(DeathState s, bool despawn)
 {
+    InvalidateCachedVisibility();
+
     // death state needs to be updated before RemoveAllAurasOnDeath() calls HandleChannelDeathItem(..) so that
     // it can be used to check creation of death items (such as soul shards).
 
@@ -20205,6 +20217,8 @@ void Unit::SetPhaseMask(uint32 newPhaseMask, bool update)
 
 void Unit::UpdateObjectVisibility(bool forced, bool /*fromUpdate*/)
 {
+    InvalidateCachedVisibility();
+
     if (!forced)
         AddToNotify(NOTIFY_VISIBILITY_CHANGED);
     else
@@ -21745,7 +21759,7 @@ bool ConflagrateAuraStateDelayEvent::Execute(uint64 /*e_time*/, uint32  /*p_time
     return true;
 }
 
-void Unit::ExecuteDelayedUnitRelocationEvent()
+void Unit::ExecuteDelayedUnitRelocationEvent(Acore::RelocationBatch* batch)
 {
     this->RemoveFromNotify(NOTIFY_VISIBILITY_CHANGED);
     if (!this->IsInWorld() || this->IsDuringRemoveFromWorld())
@@ -21817,15 +21831,24 @@ void Unit::ExecuteDelayedUnitRelocationEvent()
             }
         }
 
-        Acore::PlayerRelocationNotifier relocateNoLarge(*player, false); // visit only objects which are not large; default distance
-        Cell::VisitAllObjects(viewPoint, relocateNoLarge, player->GetSightRange() + VISIBILITY_INC_FOR_GOBJECTS);
-        relocateNoLarge.SendToSelf();
-
-        if (!player->GetFarSightDistance())
+        if (batch)
+        {
+            batch->AddPlayer(player, viewPoint, false, player->GetSightRange() + VISIBILITY_INC_FOR_GOBJECTS);
+            if (!player->GetFarSightDistance())
+                batch->AddPlayer(player, viewPoint, true, MAX_VISIBILITY_DISTANCE);
+        }
+        else
         {
-            Acore::PlayerRelocationNotifier relocateLarge(*player, true); // visit only large objects; maximum distance
-            Cell::VisitAllObjects(viewPoint, relocateLarge, MAX_VISIBILITY_DISTANCE);
-            relocateLarge.SendToSelf();
+            Acore::PlayerRelocationNotifier relocateNoLarge(*player, false); // visit only objects which are not large; default distance
+            Cell::VisitAllObjects(viewPoint, relocateNoLarge, player->GetSightRange() + VISIBILITY_INC_FOR_GOBJECTS);
+            relocateNoLarge.SendToSelf();
+
+            if (!player->GetFarSightDistance())
+            {
+                Acore::PlayerRelocationNotifier relocateLarge(*player, true); // visit only large objects; maximum distance
+                Cell::VisitAllObjects(viewPoint, relocateLarge, MAX_VISIBILITY_DISTANCE);
+                relocateLarge.SendToSelf();
+            }
         }
 
         this->AddToNotify(NOTIFY_AI_RELOCATION);
@@ -21845,8 +21868,13 @@ void Unit::ExecuteDelayedUnitRelocationEvent()
 
         unit->m_last_notify_position.Relocate(unit->GetPositionX(), unit->GetPositionY(), unit->GetPositionZ());
 
-        Acore::CreatureRelocationNotifier relocate(*unit);
-        Cell::VisitAllObjects(unit, relocate, unit->GetVisibilityRange() + VISIBILITY_COMPENSATION);
+        if (batch)
+            batch->AddCreature(unit, unit->GetVisibilityRange() + VISIBILITY_COMPENSATION);
+        else
+        {
+            Acore::CreatureRelocationNotifier relocate(*unit);
+            Cell::VisitAllObjects(unit, relocate, unit->GetVisibilityRange() + VISIBILITY_COMPENSATION);
+        }
 
         this->AddToNotify(NOTIFY_AI_RELOCATION);
     }
@@ -22069,15 +22097,24 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target)
     if (plr && plr->IsInSameRaidWith(target))
         visibleFlag |= UF_FLAG_PARTY_MEMBER;
 
+    bool const perCasterAuraState = HasFlag(UNIT_FIELD_AURASTATE, PER_CASTER_AURA_STATE_MASK);
+
     Creature const* creature = ToCreature();
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    for (uint32 block = 0; block < updateMask.GetBlockCount(); ++block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-                ((flags[index] & visibleFlag) & UF_FLAG_SPECIAL_INFO) ||
-                ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)) ||
-                (index == UNIT_FIELD_AURASTATE && HasFlag(UNIT_FIELD_AURASTATE, PER_CASTER_AURA_STATE_MASK)))
+        uint32 fields = GetUpdateFieldsInBlock(updateType, flags, visibleFlag, block);
+
+        // special info fields are always sent to viewers allowed to see them
+        fields |= GetUpdateFieldFlagsBlock(flags, visibleFlag & UF_FLAG_SPECIAL_INFO, block);
+
+        if (perCasterAuraState && block == UpdateMask::GetBlockIndex(UNIT_FIELD_AURASTATE))
+            fields |= UpdateMask::GetBlockBit(UNIT_FIELD_AURASTATE);
+
+        updateMask.SetBlock(block, fields);
+
+        for (; fields; fields &= fields - 1)
         {
-            updateMask.SetBit(index);
+            uint16 index = block * UpdateMask::CLIENT_UPDATE_MASK_BITS + std::countr_zero(fields);
 
             if (index == UNIT_NPC_FLAGS)
             {
@@ -237,6 +237,11 @@ class Vehicle;
 class TransportBase;
 class SpellCastTargets;
 
+namespace Acore
+{
+    class RelocationBatch;
+}
+
 typedef std::list<Unit*> UnitList;
 typedef std::list< std::pair<Aura*, uint8> > DispelChargesList;
 
@@ -2453,7 +2458,8 @@ public:
     uint16 m_delayed_unit_relocation_timer;
     uint16 m_delayed_unit_ai_notify_timer;
     bool bRequestForcedVisibilityUpdate;
-    void ExecuteDelayedUnitRelocationEvent();
+    // with a batch the relocation scans are queued there and run by Map::HandleDelayedVisibility
+    void ExecuteDelayedUnitRelocationEvent(Acore::RelocationBatch* batch = nullptr);
     void ExecuteDelayedUnitAINotifyEvent();
 
     // cooldowns
@@ -104,6 +104,13 @@ public:
         ASSERT(obj->IsInGrid());
     }
 
+    /** Number of objects of a type in the world container (players, pets, resurrectable corpses, far sight targets)
+     */
+    template<class SPECIFIC_OBJECT> [[nodiscard]] std::size_t GetWorldObjectCount() const
+    {
+        return i_objects.template Count<SPECIFIC_OBJECT>();
+    }
+
     /** Removes a containter type object from the grid
      */
     //template<class SPECIFIC_OBJECT> void RemoveGridObject(SPECIFIC_OBJECT *obj)
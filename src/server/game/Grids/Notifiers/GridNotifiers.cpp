@@ -16,6 +16,7 @@
  */
 
 #include "GridNotifiers.h"
+#include "CellImpl.h"
 #include "GridNotifiersImpl.h"
 #include "Map.h"
 #include "ObjectAccessor.h"
@@ -190,7 +191,7 @@ void CreatureRelocationNotifier::Visit(PlayerMapType& m)
         Player* player = iter->GetSource();
 
         // NOTIFY_VISIBILITY_CHANGED does not guarantee that player will do it himself (because distance is also checked), but screw it, it's not that important
-        if (!player->m_seer->isNeedNotify(NOTIFY_VISIBILITY_CHANGED))
+        if (!player->m_seer->isNeedNotify(NOTIFY_VISIBILITY_CHANGED) && (!i_scannedPlayers || i_creature.IsVisibilityOverridden() || !i_scannedPlayers->count(player)))
             player->UpdateVisibilityOf(&i_creature);
 
         // NOTIFY_AI_RELOCATION does not guarantee that player will do it himself (because distance is also checked), but screw it, it's not that important
@@ -215,6 +216,172 @@ void AIRelocationNotifier::Visit(CreatureMapType& m)
     }
 }
 
+namespace
+{
+    // hands every visited container to the notifiers whose scan area contains the current cell
+    template<class Notifier>
+    struct RelocationFanOut
+    {
+        std::vector<Notifier*>& i_notifiers;
+        explicit RelocationFanOut(std::vector<Notifier*>& notifiers) : i_notifiers(notifiers) { }
+
+        template<class T> void Visit(GridRefMgr<T>& m)
+        {
+            for (Notifier* notifier : i_notifiers)
+                notifier->Visit(m);
+        }
+    };
+
+    bool Contains(CellArea const& area, uint32 x, uint32 y)
+    {
+        return x >= area.low_bound.x_coord && x <= area.high_bound.x_coord && y >= area.low_bound.y_coord && y <= area.high_bound.y_coord;
+    }
+
+    bool IsScannable(Unit const* unit)
+    {
+        return unit->IsInWorld() && !unit->IsDuringRemoveFromWorld();
+    }
+
+    void SendToSelf(PlayerRelocationNotifier& notifier) { notifier.SendToSelf(); }
+    void SendToSelf(CreatureRelocationNotifier& /*notifier*/) { }
+}
+
+void RelocationBatch::AddPlayer(Player* player, WorldObject const* viewPoint, bool largeOnly, float radius)
+{
+    Add(largeOnly ? i_largePlayerScans : i_playerScans, player, viewPoint, radius);
+
+    // a player looking through a far sight object or another viewpoint did not scan the cells around himself
+    if (viewPoint == player && !player->GetFarSightDistance())
+        i_scannedPlayers.insert(player);
+}
+
+void RelocationBatch::AddCreature(Creature* creature, float radius)
+{
+    Add(i_creatureScans, creature, creature, radius);
+}
+
+template<class T>
+void RelocationBatch::Add(ScanGroups<T>& groups, T* source, WorldObject const* center, float radius)
+{
+    CellCoord standingCell = Acore::ComputeCellCoord(center->GetPositionX(), center->GetPositionY());
+    if (!standingCell.IsCoordValid())
+        return;
+
+    // same area as Cell::VisitAllObjects(center, notifier, radius)
+    float areaRadius = std::min(radius + center->GetCombatReach(), SIZE_OF_GRIDS);
+    groups[standingCell.GetId()].push_back({ source, center, radius, Cell::CalculateCellArea(center->GetPositionX(), center->GetPositionY(), areaRadius) });
+}
+
+template<class Notifier, class T, class Factory>
+uint32 RelocationBatch::Sweep(Map& map, ScanGroups<T>& groups, Factory makeNotifier)
+{
+    uint32 saved = 0;
+    std::vector<std::unique_ptr<Notifier>> notifiers;
+    std::vector<Scan<T> const*> activeScans;
+    std::vector<Notifier*> targets;
+
+    for (auto& [standingCell, scans] : groups)
+    {
+        notifiers.clear();
+        activeScans.clear();
+
+        // a pet can be removed by the visibility update of an earlier scan
+        CellArea total;
+        for (Scan<T> const& scan : scans)
+        {
+            if (!IsScannable(scan.Source))
+                continue;
+
+            if (activeScans.empty())
+                total = scan.Area;
+            else
+            {
+                total.low_bound.x_coord = std::min(total.low_bound.x_coord, scan.Area.low_bound.x_coord);
+                total.low_bound.y_coord = std::min(total.low_bound.y_coord, scan.Area.low_bound.y_coord);
+                total.high_bound.x_coord = std::max(total.high_bound.x_coord, scan.Area.high_bound.x_coord);
+                total.high_bound.y_coord = std::max(total.high_bound.y_coord, scan.Area.high_bound.y_coord);
+            }
+
+            notifiers.push_back(makeNotifier(scan.Source));
+            activeScans.push_back(&scan);
+        }
+
+        if (notifiers.empty())
+            continue;
+
+        // nothing to merge, VisitCircle skips the corners of big areas that the sweep would visit
+        if (notifiers.size() == 1)
+        {
+            Cell::VisitAllObjects(activeScans.front()->Center, *notifiers.front(), activeScans.front()->Radius);
+            SendToSelf(*notifiers.front());
+            continue;
+        }
+
+        for (uint32 x = total.low_bound.x_coord; x <= total.high_bound.x_coord; ++x)
+        {
+            for (uint32 y = total.low_bound.y_coord; y <= total.high_bound.y_coord; ++y)
+            {
+                targets.clear();
+                for (std::size_t i = 0; i < notifiers.size(); ++i)
+                    if (Contains(activeScans[i]->Area, x, y))
+                        targets.push_back(notifiers[i].get());
+
+                if (targets.empty())
+                    continue;
+
+                Cell cell(CellCoord(x, y));
+                cell.SetNoCreate();
+
+                RelocationFanOut<Notifier> fanOut(targets);
+                TypeContainerVisitor<RelocationFanOut<Notifier>, WorldTypeMapContainer> worldVisitor(fanOut);
+                map.Visit(cell, worldVisitor);
+                TypeContainerVisitor<RelocationFanOut<Notifier>, GridTypeMapContainer> gridVisitor(fanOut);
+                map.Visit(cell, gridVisitor);
+            }
+        }
+
+        for (std::unique_ptr<Notifier>& notifier : notifiers)
+            SendToSelf(*notifier);
+
+        saved += notifiers.size() - 1;
+    }
+
+    groups.clear();
+    return saved;
+}
+
+uint32 RelocationBatch::Execute(Map& map)
+{
+    uint32 saved = Sweep<PlayerRelocationNotifier>(map, i_playerScans, [](Player* player) { return std::make_unique<PlayerRelocationNotifier>(*player, false); });
+    saved += Sweep<PlayerRelocationNotifier>(map, i_largePlayerScans, [](Player* player) { return std::make_unique<PlayerRelocationNotifier>(*player, true); });
+    saved += Sweep<CreatureRelocationNotifier>(map, i_creatureScans, [this](Creature* creature) { return std::make_unique<CreatureRelocationNotifier>(*creature, &i_scannedPlayers); });
+    i_scannedPlayers.clear();
+    return saved;
+}
+
+PacketBroadcast::~PacketBroadcast()
+{
+    if (i_firstReceiver && !i_sharedPacket)
+        i_firstReceiver->SendPacket(i_packet);
+}
+
+void PacketBroadcast::Send(WorldSession* session)
+{
+    if (!i_firstReceiver)
+    {
+        i_firstReceiver = session;
+        return;
+    }
+
+    if (!i_sharedPacket)
+    {
+        i_sharedPacket = std::make_shared<WorldPacket const>(*i_packet);
+        i_firstReceiver->SendPacket(i_sharedPacket);
+    }
+
+    session->SendPacket(i_sharedPacket);
+}
+
 void MessageDistDeliverer::Visit(PlayerMapType& m)
 {
     for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
@@ -343,6 +510,20 @@ void MessageDistDelivererToHostile::Visit(DynamicObjectMapType& m)
     }
 }
 
+namespace
+{
+    // dead creatures and despawned gameobjects are woken by Map::ProcessRespawnQueue
+    template<class T>
+    bool IsWaitingForRespawn(T const* /*obj*/) { return false; }
+    bool IsWaitingForRespawn(Creature const* creature) { return creature->IsWaitingForRespawn(); }
+    bool IsWaitingForRespawn(GameObject const* go) { return go->IsWaitingForRespawn(); }
+
+    // idle creatures only get an update every Creature.IdleUpdateInterval, the skipped time is passed on when they wake up
+    template<class T>
+    bool Sleep(T* /*obj*/, uint32& /*diff*/) { return false; }
+    bool Sleep(Creature* creature, uint32& diff) { return creature->Sleep(diff); }
+}
+
 template<class T>
 void ObjectUpdater::Visit(GridRefMgr<T>& m)
 {
@@ -351,8 +532,17 @@ void ObjectUpdater::Visit(GridRefMgr<T>& m)
     {
         obj = iter->GetSource();
         ++iter;
-        if (obj->IsInWorld() && (i_largeOnly == obj->IsVisibilityOverridden()))
-            obj->Update(i_timeDiff);
+        if (!obj->IsInWorld() || i_largeOnly != obj->IsVisibilityOverridden())
+            continue;
+
+        uint32 diff = i_timeDiff;
+        if (IsWaitingForRespawn(obj) || Sleep(obj, diff))
+        {
+            ++i_skippedUpdates;
+            continue;
+        }
+
+        obj->Update(diff);
     }
 }
 
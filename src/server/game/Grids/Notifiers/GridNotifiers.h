@@ -80,11 +80,52 @@ namespace Acore
     struct CreatureRelocationNotifier
     {
         Creature& i_creature;
-        CreatureRelocationNotifier(Creature& c) : i_creature(c) {}
+        std::unordered_set<Player const*> const* i_scannedPlayers;   // players whose own scan of the same RelocationBatch already saw the creature
+        CreatureRelocationNotifier(Creature& c, std::unordered_set<Player const*> const* scannedPlayers = nullptr) : i_creature(c), i_scannedPlayers(scannedPlayers) {}
         template<class T> void Visit(GridRefMgr<T>&) {}
         void Visit(PlayerMapType&);
     };
 
+    // Relocation scans queued by Unit::ExecuteDelayedUnitRelocationEvent during one Map::HandleDelayedVisibility.
+    // Scans of units standing in the same cell share one sweep over the union of their cell areas, every cell
+    // is only handed to the notifiers whose own area contains it, so each notifier sees the cells it would
+    // have visited alone (the corners VisitCircle skips for big radiuses included). A unit alone in its cell
+    // is scanned by Cell::VisitAllObjects as it would be without a batch.
+    class RelocationBatch
+    {
+    public:
+        void AddPlayer(Player* player, WorldObject const* viewPoint, bool largeOnly, float radius);
+        void AddCreature(Creature* creature, float radius);
+
+        // runs and clears the queued scans, returns how many sweeps were saved by merging them
+        uint32 Execute(Map& map);
+
+    private:
+        template<class T>
+        struct Scan
+        {
+            T* Source;
+            WorldObject const* Center;
+            float Radius;
+            CellArea Area;
+        };
+
+        template<class T>
+        using ScanGroups = std::map<uint32 /*standing cell*/, std::vector<Scan<T>>>;
+
+        template<class T>
+        static void Add(ScanGroups<T>& groups, T* source, WorldObject const* center, float radius);
+
+        template<class Notifier, class T, class Factory>
+        static uint32 Sweep(Map& map, ScanGroups<T>& groups, Factory makeNotifier);
+
+        // large objects are scanned after the normal ones, like Unit::ExecuteDelayedUnitRelocationEvent does without a batch
+        ScanGroups<Player> i_playerScans;
+        ScanGroups<Player> i_largePlayerScans;
+        ScanGroups<Creature> i_creatureScans;
+        std::unordered_set<Player const*> i_scannedPlayers;                   // only players scanning around themselves up to the large object range
+    };
+
     struct AIRelocationNotifier
     {
         Unit& i_unit;
@@ -94,10 +135,32 @@ namespace Acore
         void Visit(CreatureMapType&);
     };
 
+    // Sends one packet to the receivers of a broadcast. The first receiver is held back until a second one shows up:
+    // a packet with a single receiver is sent like any direct packet when the broadcast ends, otherwise the payload
+    // is copied once and shared by the socket queues of all receivers.
+    class PacketBroadcast
+    {
+    public:
+        explicit PacketBroadcast(WorldPacket const* packet) : i_packet(packet) { }
+        PacketBroadcast(PacketBroadcast&& other) noexcept : i_packet(other.i_packet),
+            i_firstReceiver(std::exchange(other.i_firstReceiver, nullptr)), i_sharedPacket(std::move(other.i_sharedPacket)) { }
+        PacketBroadcast(PacketBroadcast const&) = delete;
+        PacketBroadcast& operator=(PacketBroadcast const&) = delete;
+        PacketBroadcast& operator=(PacketBroadcast&&) = delete;
+        ~PacketBroadcast();
+
+        void Send(WorldSession* session);
+
+    private:
+        WorldPacket const* i_packet;
+        WorldSession* i_firstReceiver{nullptr};
+        std::shared_ptr<WorldPacket const> i_sharedPacket;
+    };
+
     struct MessageDistDeliverer
     {
         WorldObject const* i_source;
-        WorldPacket const* i_message;
+        PacketBroadcast i_message;
         uint32 i_phaseMask;
         float i_distSq;
         TeamId teamId;
@@ -122,14 +185,27 @@ namespace Acore
             if (!player->HaveAtClient(i_source))
                 return;
 
-            player->GetSession()->SendPacket(i_message);
+            i_message.Send(player->GetSession());
+        }
+    };
+
+    // one grid visit for packets of several nearby sources, see Movement::MonsterMoveBatch
+    struct MessageDistDelivererBatch
+    {
+        std::vector<MessageDistDeliverer>& i_deliverers;
+        explicit MessageDistDelivererBatch(std::vector<MessageDistDeliverer>& deliverers) : i_deliverers(deliverers) { }
+
+        template<class T> void Visit(GridRefMgr<T>& m)
+        {
+            for (MessageDistDeliverer& deliverer : i_deliverers)
+                deliverer.Visit(m);
         }
     };
 
     struct MessageDistDelivererToHostile
     {
         Unit* i_source;
-        WorldPacket* i_message;
+        PacketBroadcast i_message;
         uint32 i_phaseMask;
         float i_distSq;
         MessageDistDelivererToHostile(Unit* src, WorldPacket* msg, float dist)
@@ -147,7 +223,7 @@ namespace Acore
             if (player == i_source || !player->HaveAtClient(i_source) || player->IsFriendlyTo(i_source))
                 return;
 
-            player->GetSession()->SendPacket(i_message);
+            i_message.Send(player->GetSession());
         }
     };
 
@@ -155,6 +231,7 @@ namespace Acore
     {
         uint32 i_timeDiff;
         bool i_largeOnly;
+        uint32 i_skippedUpdates{0};                         // sleeping creatures and objects waiting for respawn
         explicit ObjectUpdater(const uint32 diff, bool largeOnly) : i_timeDiff(diff), i_largeOnly(largeOnly) {}
         template<class T> void Visit(GridRefMgr<T>& m);
         void Visit(PlayerMapType&) {}
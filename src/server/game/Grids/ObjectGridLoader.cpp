@@ -22,6 +22,7 @@
 #include "CreatureAI.h"
 #include "DynamicObject.h"
 #include "GameObject.h"
+#include "GameTime.h"
 #include "ObjectMgr.h"
 #include "Transport.h"
 #include "Vehicle.h"
@@ -196,6 +197,66 @@ void ObjectGridLoader::LoadN(void)
     LOG_DEBUG("maps", "{} GameObjects, {} Creatures, and {} Corpses/Bones loaded for grid {} on map {}", i_gameObjects, i_creatures, i_corpses, i_grid.GetGridId(), i_map->GetId());
 }
 
+void ObjectGridHibernator::Visit(CreatureMapType& m)
+{
+    time_t now = GameTime::GetGameTime().count();
+    for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
+        Creature* creature = iter->GetSource();
+
+        // outside of dungeons a corpse only saves its respawn time when it is removed
+        if (!creature->IsAlive())
+        {
+            if (creature->GetRespawnTime() > now)
+                creature->SaveRespawnTime();
+            continue;
+        }
+
+        if (!creature->GetSpawnId() || creature->IsInCombat() || creature->GetVehicle() || creature->GetTransport())
+            continue;
+
+        // a spawn that wandered in from a grid which stays loaded would be missing there until that grid is reloaded as well
+        float x, y, z, o;
+        creature->GetRespawnPosition(x, y, z, &o);
+        GridCoord home = Acore::ComputeGridCoord(x, y);
+        if ((int32(home.x_coord) == i_grid.getX() && int32(home.y_coord) == i_grid.getY()) || !creature->GetMap()->IsGridLoaded(x, y))
+            continue;
+
+        creature->GetMotionMaster()->Clear(false);
+        creature->GetMap()->CreatureRelocation(creature, x, y, z, o);
+        creature->GetMotionMaster()->Initialize();
+    }
+}
+
+void ObjectGridHibernator::Visit(GameObjectMapType& m)
+{
+    for (GameObjectMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+        iter->GetSource()->SaveRespawnTime();
+}
+
+void ObjectGridHibernator::Visit(CorpseMapType& m)
+{
+    // corpses stay with the map, ObjectWorldLoader adds them again when the grid is loaded
+    while (!m.IsEmpty())
+    {
+        Corpse* corpse = m.getFirst()->GetSource();
+        corpse->RemoveFromWorld();
+        corpse->RemoveFromGrid();
+    }
+}
+
+void ObjectGridHibernationChecker::Visit(CreatureMapType& m)
+{
+    for (CreatureMapType::iterator iter = m.begin(); i_canHibernate && iter != m.end(); ++iter)
+        i_canHibernate = IsReloadedWithGrid(iter->GetSource());
+}
+
+void ObjectGridHibernationChecker::Visit(GameObjectMapType& m)
+{
+    for (GameObjectMapType::iterator iter = m.begin(); i_canHibernate && iter != m.end(); ++iter)
+        i_canHibernate = IsReloadedWithGrid(iter->GetSource());
+}
+
 template<class T>
 void ObjectGridUnloader::Visit(GridRefMgr<T>& m)
 {
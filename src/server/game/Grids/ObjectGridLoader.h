@@ -60,6 +60,38 @@ public:
     template<class T> void Visit(GridRefMgr<T>&);
 };
 
+//Keep what an idle grid must not forget before Map::HibernateIdleGrids unloads it
+class ObjectGridHibernator
+{
+public:
+    explicit ObjectGridHibernator(NGridType& grid) : i_grid(grid) { }
+
+    void Visit(CreatureMapType& m);
+    void Visit(GameObjectMapType& m);
+    void Visit(CorpseMapType& m);
+    template<class T> void Visit(GridRefMgr<T>&) { }
+
+private:
+    NGridType& i_grid;
+};
+
+//Finds objects that would be lost for good when an idle grid is unloaded, only database spawns are loaded again
+class ObjectGridHibernationChecker
+{
+public:
+    // summons and objects spawned by scripts have no spawn id, zone scripts (battlefields, outdoor pvp) keep pointers to theirs
+    template<class T> static bool IsReloadedWithGrid(T const* obj) { return obj->GetSpawnId() && !obj->GetZoneScript(); }
+
+    [[nodiscard]] bool CanHibernate() const { return i_canHibernate; }
+
+    void Visit(CreatureMapType& m);
+    void Visit(GameObjectMapType& m);
+    template<class T> void Visit(GridRefMgr<T>&) { }
+
+private:
+    bool i_canHibernate = true;
+};
+
 //Delete objects before deleting NGrid
 class ObjectGridUnloader
 {
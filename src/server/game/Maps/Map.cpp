@@ -62,6 +62,9 @@ u_map_magic MapLiquidMagic  = { {'M', 'L', 'I', 'Q'} };
 static uint16 const holetab_h[4] = { 0x1111, 0x2222, 0x4444, 0x8888 };
 static uint16 const holetab_v[4] = { 0x000F, 0x00F0, 0x0F00, 0xF000 };
 
+// how often resident grids are checked for GridUnloadIdleTime
+static uint32 const GridHibernationCheckInterval = 5 * IN_MILLISECONDS;
+
 ZoneDynamicInfo::ZoneDynamicInfo() : MusicId(0), WeatherId(WEATHER_STATE_FINE),
                                      WeatherGrade(0.0f), OverrideLightId(0), LightFadeInTime(0) { }
 
@@ -88,6 +91,24 @@ Map::~Map()
     MMAP::MMapFactory::createOrGetMMapMgr()->unloadMapInstance(GetId(), i_InstanceId);
 }
 
+dtNavMesh const* Map::GetNavMesh()
+{
+    // the navmesh is created with the first loaded tile, until then keep asking
+    if (!_navMesh)
+        _navMesh = MMAP::MMapFactory::createOrGetMMapMgr()->GetNavMesh(GetId());
+
+    return _navMesh;
+}
+
+dtNavMeshQuery const* Map::GetNavMeshQuery()
+{
+    // only used by the thread updating this map, freed in ~Map
+    if (!_navMeshQuery)
+        _navMeshQuery = MMAP::MMapFactory::createOrGetMMapMgr()->GetNavMeshQuery(GetId(), GetInstanceId());
+
+    return _navMeshQuery;
+}
+
 bool Map::ExistMap(uint32 mapid, int gx, int gy)
 {
     int len = sWorld->GetDataPath().length() + strlen("maps/%03u%02u%02u.map") + 1;
@@ -242,7 +263,8 @@ Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
     i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
     m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
     _instanceResetPeriod(0), m_activeNonPlayersIter(m_activeNonPlayers.end()),
-    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id))
+    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id)),
+    _updateTimeMetric(nullptr), _metricCounters(), _gridHibernationTimer(0)
 {
     m_parentMap = (_parent ? _parent : this);
     for (unsigned int idx = 0; idx < MAX_NUMBER_OF_GRIDS; ++idx)
@@ -466,6 +488,8 @@ void Map::EnsureGridCreated_i(const GridCoord& p)
 
         // pussywizard: moved here
         setNGrid(ngt, p.x_coord, p.y_coord);
+
+        AddMetricCounter(MAP_METRIC_GRIDS_LOADED, 1);
     }
 }
 
@@ -748,7 +772,10 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Acore::Objec
 void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 {
     if (t_diff)
+    {
         _dynamicTree.update(t_diff);
+        ProcessRespawnQueue();
+    }
 
     /// update worldsessions for existing players
     for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
@@ -885,6 +912,9 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     MoveAllDynamicObjectsInMoveList();
 
     HandleDelayedVisibility();
+    _visibilityCache.Update(t_diff);
+
+    HibernateIdleGrids(t_diff);
 
     sScriptMgr->OnMapUpdate(this, t_diff);
 
@@ -895,15 +925,109 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    AddMetricCounter(MAP_METRIC_UPDATES_SKIPPED, updater.i_skippedUpdates + largeObjectUpdater.i_skippedUpdates);
+    AddMetricCounter(MAP_METRIC_VISIBILITY_CACHE_HITS, int64(_visibilityCache.GetHits()));
+    AddMetricCounter(MAP_METRIC_VISIBILITY_CACHE_MISSES, int64(_visibilityCache.GetMisses()));
+    _visibilityCache.ResetCounters();
+}
+
+void Map::ScheduleRespawn(Creature* creature)
+{
+    // a respawn blocked by conditions or scripts is tried again next second, like it was on every update before
+    time_t respawnTime = std::max<time_t>(creature->GetRespawnTime(), GameTime::GetGameTime().count() + 1);
+    creature->SetRespawnQueueTime(respawnTime);
+    _respawnQueue.push({ respawnTime, creature->GetGUID() });
+    AddMetricCounter(MAP_METRIC_RESPAWNS_QUEUED, 1);
+}
+
+void Map::ScheduleRespawn(GameObject* go)
+{
+    time_t respawnTime = std::max<time_t>(go->GetRespawnTime(), GameTime::GetGameTime().count() + 1);
+    go->SetRespawnQueueTime(respawnTime);
+    _respawnQueue.push({ respawnTime, go->GetGUID() });
+    AddMetricCounter(MAP_METRIC_RESPAWNS_QUEUED, 1);
+}
+
+void Map::ProcessRespawnQueue()
+{
+    time_t now = GameTime::GetGameTime().count();
+    while (!_respawnQueue.empty() && _respawnQueue.top().RespawnTime <= now)
+    {
+        RespawnQueueEntry entry = _respawnQueue.top();
+        _respawnQueue.pop();
+
+        // the respawn code (linked respawns, pools, conditions) runs in Update, zero diff leaves all timers alone
+        // and the object is queued again if it stays dead, also in grids no player is near
+        if (entry.Guid.IsGameObject())
+        {
+            GameObject* go = GetGameObject(entry.Guid);
+            if (go && go->GetRespawnQueueTime() == entry.RespawnTime)
+            {
+                bool waiting = go->IsWaitingForRespawn();
+                go->SetRespawnQueueTime(0);
+                if (waiting)
+                    go->Update(0);
+            }
+        }
+        else if (Creature* creature = GetCreature(entry.Guid))
+        {
+            if (creature->GetRespawnQueueTime() == entry.RespawnTime)
+            {
+                bool waiting = creature->IsWaitingForRespawn();
+                creature->SetRespawnQueueTime(0);
+                if (waiting)
+                    creature->Update(0);
+            }
+        }
+    }
+}
+
+MetricHistogram& Map::GetUpdateTimeMetric()
+{
+    if (!_updateTimeMetric)
+        _updateTimeMetric = &sMetric->GetHistogram("map_update_time_diff", { METRIC_TAG("map_id", std::to_string(GetId())) });
+
+    return *_updateTimeMetric;
+}
+
+void Map::AddMetricCounter(MapMetricCounter counter, int64 value)
+{
+    static constexpr std::array<char const*, MAX_MAP_METRIC_COUNTERS> MetricCounterNames =
+    {
+        "map_grids_loaded",
+        "map_grids_unloaded",
+        "map_grids_hibernated",
+        "map_grids_memory_reclaimed",
+        "map_respawns_queued",
+        "map_updates_skipped",
+        "map_visibility_cache_hits",
+        "map_visibility_cache_misses",
+        "map_relocation_scans_avoided"
+    };
+
+    if (!value || !sMetric->IsEnabled())
+        return;
+
+    MetricCounter*& handle = _metricCounters[counter];
+    if (!handle)
+        handle = &sMetric->GetCounter(MetricCounterNames[counter], { METRIC_TAG("map_id", std::to_string(GetId())) });
+
+    handle->Add(value);
 }
 
 void Map::HandleDelayedVisibility()
 {
     if (i_objectsForDelayedVisibility.empty())
         return;
+
+    // units moving together (raids, bots following their owner) stand in the same cells, their scans are merged
+    Acore::RelocationBatch batch;
     for (std::unordered_set<Unit*>::iterator itr = i_objectsForDelayedVisibility.begin(); itr != i_objectsForDelayedVisibility.end(); ++itr)
-        (*itr)->ExecuteDelayedUnitRelocationEvent();
+        (*itr)->ExecuteDelayedUnitRelocationEvent(&batch);
     i_objectsForDelayedVisibility.clear();
+
+    AddMetricCounter(MAP_METRIC_RELOCATION_SCANS_AVOIDED, batch.Execute(*this));
 }
 
 struct ResetNotifier
@@ -925,6 +1049,7 @@ void Map::RemovePlayerFromMap(Player* player, bool remove)
     bool inWorld = player->IsInWorld();
     player->RemoveFromWorld();
     SendRemoveTransports(player);
+    _visibilityCache.RemoveObserver(player->GetGUID());
 
     if (!inWorld) // pussywizard: if was in world, RemoveFromWorld() called DestroyForNearbyPlayers()
         player->DestroyForNearbyPlayers(); // pussywizard: previous player->UpdateObjectVisibility(true)
@@ -1221,6 +1346,7 @@ void Map::MoveAllDynamicObjectsInMoveList()
 bool Map::UnloadGrid(NGridType& ngrid)
 {
     // pussywizard: UnloadGrid only done when whole map is unloaded, no need to worry about moving npcs between grids, etc.
+    // HibernateIdleGrids also unloads single grids, but only after the move lists were processed and strayed spawns sent home
 
     const uint32 x = ngrid.getX();
     const uint32 y = ngrid.getY();
@@ -1244,6 +1370,8 @@ bool Map::UnloadGrid(NGridType& ngrid)
     delete &ngrid;
     setNGrid(nullptr, x, y);
 
+    AddMetricCounter(MAP_METRIC_GRIDS_UNLOADED, 1);
+
     int gx = (MAX_NUMBER_OF_GRIDS - 1) - x;
     int gy = (MAX_NUMBER_OF_GRIDS - 1) - y;
 
@@ -1265,6 +1393,101 @@ bool Map::UnloadGrid(NGridType& ngrid)
     return true;
 }
 
+bool Map::IsGridInUse(NGridType& ngrid)
+{
+    for (uint32 x = 0; x < MAX_NUMBER_OF_CELLS; ++x)
+    {
+        for (uint32 y = 0; y < MAX_NUMBER_OF_CELLS; ++y)
+        {
+            // cells visited by this update are around players, active objects and creatures fighting far away players
+            uint32 cell_id = ((ngrid.getY() * MAX_NUMBER_OF_CELLS + y) * TOTAL_NUMBER_OF_CELLS_PER_MAP) + ngrid.getX() * MAX_NUMBER_OF_CELLS + x;
+            if (isCellMarked(cell_id) || isCellMarkedLarge(cell_id))
+                return true;
+
+            GridType const& cell = ngrid.GetGridType(x, y);
+            if (cell.GetWorldObjectCount<Player>() || cell.GetWorldObjectCount<Creature>() ||
+                cell.GetWorldObjectCount<GameObject>() || cell.GetWorldObjectCount<DynamicObject>())
+                return true;
+        }
+    }
+
+    ObjectGridHibernationChecker checker;
+    TypeContainerVisitor<ObjectGridHibernationChecker, GridTypeMapContainer> visitor(checker);
+    ngrid.VisitAllGrids(visitor);
+    return !checker.CanHibernate();
+}
+
+void Map::HibernateIdleGrids(uint32 diff)
+{
+    uint32 idleTime = sWorld->getIntConfig(CONFIG_GRID_UNLOAD_IDLE_TIME);
+    if (!idleTime || Instanceable())
+        return;
+
+    _gridHibernationTimer += diff;
+    if (_gridHibernationTimer < GridHibernationCheckInterval)
+        return;
+
+    uint32 elapsed = _gridHibernationTimer;
+    _gridHibernationTimer = 0;
+
+    // active objects without activation range (e.g. gameobjects) and transports don't mark cells but still keep their grid
+    std::bitset<MAX_NUMBER_OF_GRIDS * MAX_NUMBER_OF_GRIDS> pinnedGrids;
+    auto pinGrid = [&pinnedGrids](WorldObject const* obj)
+    {
+        GridCoord p = Acore::ComputeGridCoord(obj->GetPositionX(), obj->GetPositionY());
+        if (p.IsCoordValid())
+            pinnedGrids.set(p.x_coord * MAX_NUMBER_OF_GRIDS + p.y_coord);
+    };
+
+    for (WorldObject const* obj : m_activeNonPlayers)
+        pinGrid(obj);
+
+    for (MotionTransport const* transport : _transports)
+        pinGrid(transport);
+
+    std::vector<NGridType*> idleGrids;
+    for (GridRefMgr<NGridType>::iterator i = GridRefMgr<NGridType>::begin(); i != GridRefMgr<NGridType>::end(); ++i)
+    {
+        NGridType* grid = i->GetSource();
+
+        if (pinnedGrids.test(grid->GetGridId()) || IsGridInUse(*grid))
+        {
+            grid->SetIdleTime(0);
+            continue;
+        }
+
+        grid->SetIdleTime(grid->GetIdleTime() + elapsed);
+        if (grid->GetIdleTime() >= idleTime)
+            idleGrids.push_back(grid);
+    }
+
+    for (NGridType* grid : idleGrids)
+    {
+        uint32 const x = grid->getX();
+        uint32 const y = grid->getY();
+        GridMap const* gridMap = GridMaps[(MAX_NUMBER_OF_GRIDS - 1) - x][(MAX_NUMBER_OF_GRIDS - 1) - y];
+        uint32 memory = gridMap ? gridMap->GetMemoryUsage() : 0;
+
+        {
+            ObjectGridHibernator worker(*grid);
+            TypeContainerVisitor<ObjectGridHibernator, GridTypeMapContainer> gridVisitor(worker);
+            grid->VisitAllGrids(gridVisitor);
+            TypeContainerVisitor<ObjectGridHibernator, WorldTypeMapContainer> worldVisitor(worker);
+            grid->VisitAllGrids(worldVisitor);
+        }
+
+        // spawns the hibernator sent back to their own grid
+        MoveAllCreaturesInMoveList();
+
+        UnloadGrid(*grid); // objects are loaded again by EnsureGridLoaded, respawn times come from the map
+
+        AddMetricCounter(MAP_METRIC_GRIDS_HIBERNATED, 1);
+        AddMetricCounter(MAP_METRIC_GRIDS_MEMORY_RECLAIMED, memory);
+
+        LOG_DEBUG("maps", "Hibernated grid[{}, {}] for map {} after {} ms without players, {} bytes of terrain released", x, y, GetId(), idleTime, memory);
+    }
+}
+
 void Map::RemoveAllPlayers()
 {
     if (HavePlayers())
@@ -1354,6 +1577,7 @@ GridMap::GridMap()
     _liquidFlags = nullptr;
     _liquidMap  = nullptr;
     _holes = nullptr;
+    _memoryUsage = 0;
 }
 
 GridMap::~GridMap()
@@ -1408,6 +1632,7 @@ bool GridMap::loadData(char* filename)
             fclose(in);
             return false;
         }
+        _memoryUsage = header.areaMapSize + header.heightMapSize + header.liquidMapSize + header.holesSize;
         fclose(in);
         return true;
     }
@@ -1436,6 +1661,7 @@ void GridMap::unloadData()
     _liquidFlags = nullptr;
     _liquidMap  = nullptr;
     _holes = nullptr;
+    _memoryUsage = 0;
     _gridGetHeight = &GridMap::getHeightFromFlat;
 }
 
@@ -2769,8 +2995,12 @@ uint32 Map::GetPlayersCountExceptGMs() const
 
 void Map::SendToPlayers(WorldPacket const* data) const
 {
+    if (m_mapRefMgr.IsEmpty())
+        return;
+
+    std::shared_ptr<WorldPacket const> sharedData = std::make_shared<WorldPacket const>(*data);
     for (MapRefMgr::const_iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
-        itr->GetSource()->GetSession()->SendPacket(data);
+        itr->GetSource()->GetSession()->SendPacket(sharedData);
 }
 
 template<class T>
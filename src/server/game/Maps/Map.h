@@ -33,12 +33,17 @@
 #include "Position.h"
 #include "SharedDefines.h"
 #include "Timer.h"
+#include "VisibilityCache.h"
+#include <array>
 #include <bitset>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <queue>
 #include <shared_mutex>
 
+class MetricCounter;
+class MetricHistogram;
 class Unit;
 class WorldPacket;
 class InstanceScript;
@@ -60,6 +65,8 @@ class Transport;
 class StaticTransport;
 class MotionTransport;
 class PathGenerator;
+class dtNavMesh;
+class dtNavMeshQuery;
 
 enum WeatherState : uint32;
 
@@ -138,6 +145,21 @@ struct map_liquidHeader
     float  liquidLevel;
 };
 
+// Per map id counters, sent as the change since the previous Metric.Interval
+enum MapMetricCounter
+{
+    MAP_METRIC_GRIDS_LOADED,
+    MAP_METRIC_GRIDS_UNLOADED,
+    MAP_METRIC_GRIDS_HIBERNATED,
+    MAP_METRIC_GRIDS_MEMORY_RECLAIMED,
+    MAP_METRIC_RESPAWNS_QUEUED,
+    MAP_METRIC_UPDATES_SKIPPED,
+    MAP_METRIC_VISIBILITY_CACHE_HITS,
+    MAP_METRIC_VISIBILITY_CACHE_MISSES,
+    MAP_METRIC_RELOCATION_SCANS_AVOIDED,
+    MAX_MAP_METRIC_COUNTERS
+};
+
 enum LiquidStatus
 {
     LIQUID_MAP_NO_WATER     = 0x00000000,
@@ -234,6 +256,7 @@ class GridMap
     uint8 _liquidWidth;
     uint8 _liquidHeight;
     uint16* _holes;
+    uint32 _memoryUsage;
 
     bool loadAreaData(FILE* in, uint32 offset, uint32 size);
     bool loadHeightData(FILE* in, uint32 offset, uint32 size);
@@ -255,6 +278,9 @@ public:
     bool loadData(char* filaname);
     void unloadData();
 
+    // bytes of terrain data read from the .map file
+    [[nodiscard]] uint32 GetMemoryUsage() const { return _memoryUsage; }
+
     [[nodiscard]] uint16 getArea(float x, float y) const;
     [[nodiscard]] inline float getHeight(float x, float y) const {return (this->*_gridGetHeight)(x, y);}
     [[nodiscard]] float getMinHeight(float x, float y) const;
@@ -347,6 +373,11 @@ public:
 
     virtual void Update(const uint32, const uint32, bool thread = true);
 
+    /// Update time histogram shared by every map with this id, registered on first use
+    MetricHistogram& GetUpdateTimeMetric();
+    /// Counters are shared by every map with this id too, so instances don't register a handle each
+    void AddMetricCounter(MapMetricCounter counter, int64 value);
+
     [[nodiscard]] float GetVisibilityRange() const { return m_VisibleDistance; }
     void SetVisibilityRange(float range) { m_VisibleDistance = range; }
     //function for setting up visibility distance for maps on per-type/per-Id basis
@@ -384,6 +415,11 @@ public:
 
     // pussywizard: movemaps, mmaps
     [[nodiscard]] std::shared_mutex& GetMMapLock() const { return *(const_cast<std::shared_mutex*>(&MMapLock)); }
+    // navmesh of this map and the query of this instance, reused by every PathGenerator created on it
+    [[nodiscard]] dtNavMesh const* GetNavMesh();
+    [[nodiscard]] dtNavMeshQuery const* GetNavMeshQuery();
+    // results of the visibility checks of the players on this map
+    [[nodiscard]] VisibilityCache& GetVisibilityCache() { return _visibilityCache; }
     // pussywizard:
     std::unordered_set<Unit*> i_objectsForDelayedVisibility;
     void HandleDelayedVisibility();
@@ -592,6 +628,10 @@ public:
     void RemoveGORespawnTime(ObjectGuid::LowType dbGuid);
     void LoadRespawnTimes();
     void DeleteRespawnTimes();
+
+    // dead creatures and despawned gameobjects are skipped by the grid update until the respawn queue wakes them
+    void ScheduleRespawn(Creature* creature);
+    void ScheduleRespawn(GameObject* go);
     [[nodiscard]] time_t GetInstanceResetPeriod() const { return _instanceResetPeriod; }
 
     void LoadCorpseData();
@@ -692,12 +732,20 @@ private:
 
     void UpdateActiveCells(const float& x, const float& y, const uint32 t_diff);
 
+    // unloads grids of non-instanceable maps that nothing used for GridUnloadIdleTime
+    void HibernateIdleGrids(uint32 diff);
+    [[nodiscard]] bool IsGridInUse(NGridType& ngrid);
+
     void SendObjectUpdates();
 
+    void ProcessRespawnQueue();
+
 protected:
     std::mutex Lock;
     std::mutex GridLock;
     std::shared_mutex MMapLock;
+    dtNavMesh const* _navMesh{nullptr};
+    dtNavMeshQuery const* _navMeshQuery{nullptr};
 
     MapEntry const* i_mapEntry;
     uint8 i_spawnMode;
@@ -776,9 +824,27 @@ private:
     std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> _creatureRespawnTimes;
     std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> _goRespawnTimes;
 
+    struct RespawnQueueEntry
+    {
+        time_t RespawnTime;
+        ObjectGuid Guid;
+
+        bool operator>(RespawnQueueEntry const& right) const { return RespawnTime > right.RespawnTime; }
+    };
+
+    // entries of objects that respawned, were deleted or queued again are skipped when they come up
+    std::priority_queue<RespawnQueueEntry, std::vector<RespawnQueueEntry>, std::greater<RespawnQueueEntry>> _respawnQueue;
+
+    VisibilityCache _visibilityCache;
+
     ZoneDynamicInfoMap _zoneDynamicInfo;
     uint32 _defaultLight;
 
+    MetricHistogram* _updateTimeMetric;
+    std::array<MetricCounter*, MAX_MAP_METRIC_COUNTERS> _metricCounters;
+
+    uint32 _gridHibernationTimer;
+
     template<HighGuid high>
     inline ObjectGuidGeneratorBase& GetGuidSequenceGenerator()
     {
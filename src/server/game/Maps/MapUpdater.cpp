@@ -40,7 +40,7 @@ public:
 
     void call() override
     {
-        METRIC_TIMER("map_update_time_diff", METRIC_TAG("map_id", std::to_string(m_map.GetId())));
+        METRIC_HISTOGRAM_TIMER_FOR(m_map.GetUpdateTimeMetric());
         m_map.Update(m_diff, s_diff);
         m_updater.update_finished();
     }
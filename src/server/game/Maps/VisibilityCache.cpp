@@ -0,0 +1,100 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "VisibilityCache.h"
+#include "GameTime.h"
+#include "Player.h"
+#include "World.h"
+
+#define VISIBILITY_CACHE_PRUNE_INTERVAL (30 * IN_MILLISECONDS)
+
+bool VisibilityCache::CanSeeOrDetect(Player const* observer, WorldObject const* target)
+{
+    uint32 duration = sWorld->getIntConfig(CONFIG_VISIBILITY_CACHE_DURATION);
+    if (!duration || !IsCacheable(observer, target))
+        return observer->CanSeeOrDetect(target, false, true);
+
+    uint32 now = GameTime::GetGameTimeMS().count();
+
+    auto& entries = _entries[observer->GetGUID()];
+    auto itr = entries.find(target->GetGUID());
+    if (itr != entries.end())
+    {
+        if (IsEntryCurrent(itr->second, observer, target, now, duration))
+        {
+            ++_hits;
+            return itr->second.Visible;
+        }
+    }
+
+    ++_misses;
+
+    bool visible = observer->CanSeeOrDetect(target, false, true);
+    entries[target->GetGUID()] = { observer->GetPositionX(), observer->GetPositionY(), observer->GetPositionZ(),
+        target->GetPositionX(), target->GetPositionY(), target->GetPositionZ(),
+        observer->GetVisibilityStamp(), target->GetVisibilityStamp(), now, visible };
+    return visible;
+}
+
+void VisibilityCache::Update(uint32 diff)
+{
+    _pruneTimer += diff;
+    if (_pruneTimer < VISIBILITY_CACHE_PRUNE_INTERVAL)
+        return;
+
+    _pruneTimer = 0;
+
+    uint32 duration = sWorld->getIntConfig(CONFIG_VISIBILITY_CACHE_DURATION);
+    uint32 now = GameTime::GetGameTimeMS().count();
+    for (auto observerItr = _entries.begin(); observerItr != _entries.end();)
+    {
+        auto& entries = observerItr->second;
+        for (auto itr = entries.begin(); itr != entries.end();)
+        {
+            if (getMSTimeDiff(itr->second.CheckTime, now) >= duration)
+                itr = entries.erase(itr);
+            else
+                ++itr;
+        }
+
+        if (entries.empty())
+            observerItr = _entries.erase(observerItr);
+        else
+            ++observerItr;
+    }
+}
+
+bool VisibilityCache::IsCacheable(Player const* observer, WorldObject const* target)
+{
+    if (!target->IsInWorld())
+        return false;
+
+    // stealth and invisibility detection depend on facing and exact distance
+    if (target->m_stealth.GetFlags() || target->m_invisibility.GetFlags())
+        return false;
+
+    // ghosts see through their corpse, far sight and viewpoints move the eye away from the player
+    if (observer->isDead() || observer->GetViewpoint() || observer->GetFarSightDistance() || observer->IsSpectator())
+        return false;
+
+    // accessories depend on what the client already knows about the vehicle
+    if (Unit const* unit = target->ToUnit())
+        if (unit->GetVehicleBase())
+            return false;
+
+    return true;
+}
@@ -0,0 +1,88 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_VISIBILITY_CACHE_H
+#define ACORE_VISIBILITY_CACHE_H
+
+#include "Define.h"
+#include "ObjectGuid.h"
+#include "Timer.h"
+#include <unordered_map>
+
+#define VISIBILITY_CACHE_MOVE_DISTANCE 2.0f
+
+class Player;
+class WorldObject;
+
+/**
+    @class VisibilityCache
+
+    @brief Remembers the result of Player::CanSeeOrDetect(target, false, true) per player and object of one map
+
+    An entry is used until Visibility.CacheDuration passed, either side moved more than
+    VISIBILITY_CACHE_MOVE_DISTANCE or either side's WorldObject::GetVisibilityStamp() changed (auras,
+    phase, death state, despawns and respawns, forced visibility updates). Pairs whose result depends
+    on facing or on the client state (stealth, invisibility, far sight, ghosts, vehicle accessories)
+    are never cached.
+    Only used from the map update thread.
+*/
+class AC_GAME_API VisibilityCache
+{
+public:
+    bool CanSeeOrDetect(Player const* observer, WorldObject const* target);
+
+    // drops the entries of a player leaving the map
+    void RemoveObserver(ObjectGuid guid) { _entries.erase(guid); }
+
+    // drops expired entries, including those of objects that left the map
+    void Update(uint32 diff);
+
+    [[nodiscard]] uint64 GetHits() const { return _hits; }
+    [[nodiscard]] uint64 GetMisses() const { return _misses; }
+    void ResetCounters() { _hits = 0; _misses = 0; }
+
+    struct Entry
+    {
+        float ObserverX, ObserverY, ObserverZ;
+        float TargetX, TargetY, TargetZ;
+        uint32 ObserverStamp;
+        uint32 TargetStamp;
+        uint32 CheckTime;                                  // GameTime::GetGameTimeMS
+        bool Visible;
+    };
+
+    // false once the entry expired, either side moved too far or either side's visibility stamp changed
+    template<class Observer, class Target>
+    static bool IsEntryCurrent(Entry const& entry, Observer const* observer, Target const* target, uint32 now, uint32 duration)
+    {
+        float const maxDistSq = VISIBILITY_CACHE_MOVE_DISTANCE * VISIBILITY_CACHE_MOVE_DISTANCE;
+        return getMSTimeDiff(entry.CheckTime, now) < duration
+            && entry.ObserverStamp == observer->GetVisibilityStamp() && entry.TargetStamp == target->GetVisibilityStamp()
+            && observer->GetExactDistSq(entry.ObserverX, entry.ObserverY, entry.ObserverZ) <= maxDistSq
+            && target->GetExactDistSq(entry.TargetX, entry.TargetY, entry.TargetZ) <= maxDistSq;
+    }
+
+private:
+    static bool IsCacheable(Player const* observer, WorldObject const* target);
+
+    std::unordered_map<ObjectGuid, std::unordered_map<ObjectGuid, Entry>> _entries;
+    uint32 _pruneTimer{0};
+    uint64 _hits{0};
+    uint64 _misses{0};
+};
+
+#endif
@@ -406,6 +406,26 @@ void MotionMaster::MovePoint(uint32 id, float x, float y, float z, bool generate
     }
 }
 
+// path is used as given, its first point is replaced by the current position
+void MotionMaster::MovePoint(uint32 id, Movement::PointsArray const& path, MovementSlot slot)
+{
+    // Xinef: do not allow to move with UNIT_FLAG_DISABLE_MOVE
+    if (_owner->HasUnitFlag(UNIT_FLAG_DISABLE_MOVE) || path.size() < 2)
+        return;
+
+    G3D::Vector3 const& dest = path.back();
+    if (_owner->GetTypeId() == TYPEID_PLAYER)
+    {
+        LOG_DEBUG("movement.motionmaster", "Player ({}) targeted point by path (Id: {} X: {} Y: {} Z: {})", _owner->GetGUID().ToString(), id, dest.x, dest.y, dest.z);
+        Mutate(new PointMovementGenerator<Player>(id, dest.x, dest.y, dest.z, 0.0f, 0.0f, &path, false, true), slot);
+    }
+    else
+    {
+        LOG_DEBUG("movement.motionmaster", "Creature ({}) targeted point by path (ID: {} X: {} Y: {} Z: {})", _owner->GetGUID().ToString(), id, dest.x, dest.y, dest.z);
+        Mutate(new PointMovementGenerator<Creature>(id, dest.x, dest.y, dest.z, 0.0f, 0.0f, &path, false, true), slot);
+    }
+}
+
 void MotionMaster::MoveSplinePath(Movement::PointsArray* path)
 {
     // Xinef: do not allow to move with UNIT_FLAG_DISABLE_MOVE
@@ -210,6 +210,7 @@ public:
     void MovePoint(uint32 id, const Position& pos, bool generatePath = true, bool forceDestination = true)
     { MovePoint(id, pos.m_positionX, pos.m_positionY, pos.m_positionZ, generatePath, forceDestination, MOTION_SLOT_ACTIVE, pos.GetOrientation()); }
     void MovePoint(uint32 id, float x, float y, float z, bool generatePath = true, bool forceDestination = true, MovementSlot slot = MOTION_SLOT_ACTIVE, float orientation = 0.0f);
+    void MovePoint(uint32 id, Movement::PointsArray const& path, MovementSlot slot = MOTION_SLOT_ACTIVE);
     void MoveSplinePath(Movement::PointsArray* path);
 
     // These two movement types should only be used with creatures having landing/takeoff animations
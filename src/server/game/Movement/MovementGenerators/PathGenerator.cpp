@@ -36,6 +36,12 @@ PathGenerator::PathGenerator(WorldObject const* owner) :
 
     uint32 mapId = _source->GetMapId();
     //if (DisableMgr::IsPathfindingEnabled(_sourceUnit->FindMap()))
+    if (Map* map = _source->FindMap())
+    {
+        _navMesh = map->GetNavMesh();
+        _navMeshQuery = map->GetNavMeshQuery();
+    }
+    else
     {
         MMAP::MMapMgr* mmap = MMAP::MMapFactory::createOrGetMMapMgr();
         _navMesh = mmap->GetNavMesh(mapId);
@@ -699,6 +705,25 @@ NavTerrain PathGenerator::GetNavTerrain(float x, float y, float z) const
     }
 }
 
+PathType PathGenerator::MoveToNavMesh(G3D::Vector3& point) const
+{
+    if (!_navMesh || !_navMeshQuery || !HaveTile(point))
+        return PATHFIND_NOT_USING_PATH;
+
+    float distance;
+    float location[VERTEX_SIZE] = { point.y, point.z, point.x };
+    dtPolyRef polyRef = GetPolyByLocation(location, &distance);
+    if (polyRef == INVALID_POLYREF)
+        return PATHFIND_NOPATH;
+
+    float closestPoint[VERTEX_SIZE];
+    if (dtStatusFailed(_navMeshQuery->closestPointOnPoly(polyRef, location, closestPoint, nullptr)))
+        return PATHFIND_NOPATH;
+
+    point = G3D::Vector3(closestPoint[2], closestPoint[0], closestPoint[1]);
+    return PATHFIND_NORMAL;
+}
+
 bool PathGenerator::HaveTile(const G3D::Vector3& p) const
 {
     int tx = -1, ty = -1;
@@ -75,6 +75,10 @@ class PathGenerator
         [[nodiscard]] bool IsSwimmableSegment(float x, float y, float z, float destX, float destY, float destZ, bool checkSwim = true) const;
         [[nodiscard]] static float GetRequiredHeightToClimb(float x, float y, float z, float destX, float destY, float destZ, float sourceHeight);
 
+        // moves point onto the closest polygon the owner can walk or swim on
+        // return: PATHFIND_NORMAL if moved, PATHFIND_NOPATH if there is no polygon nearby, PATHFIND_NOT_USING_PATH if there is no navmesh there
+        PathType MoveToNavMesh(G3D::Vector3& point) const;
+
         // option setters - use optional
 
         // when set, it skips paths with too high slopes (doesn't work with StraightPath enabled)
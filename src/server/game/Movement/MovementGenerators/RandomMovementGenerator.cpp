@@ -255,6 +255,24 @@ void RandomMovementGenerator<Creature>::DoInitialize(Creature* creature)
             float factor = 0.5f + rand_norm() * 0.5f;
             _destinationPoints.push_back(G3D::Vector3(_initialPosition.GetPositionX() + _wanderDistance * cos(angle)*factor, _initialPosition.GetPositionY() + _wanderDistance * std::sin(angle)*factor, _initialPosition.GetPositionZ()));
         }
+
+        // wander polygon set: ground destinations are moved onto the navmesh once,
+        // points without a polygon nearby are dropped instead of failing a path calculation on every try.
+        // Swimmers keep their points, the closest polygon in water is the surface and the depth is picked per move
+        if (!creature->CanFly() && creature->CanWalk() && !creature->IsInWater())
+        {
+            if (!_pathGenerator)
+                _pathGenerator = new PathGenerator(creature);
+
+            for (uint8 i = 0; i < RANDOM_POINTS_NUMBER; ++i)
+            {
+                if (_pathGenerator->MoveToNavMesh(_destinationPoints[i]) != PATHFIND_NOPATH)
+                    continue;
+
+                for (std::vector<uint8>& links : _validPointsVector)
+                    links.erase(std::remove(links.begin(), links.end(), i), links.end());
+            }
+        }
     }
 
     creature->AddUnitState(UNIT_STATE_ROAMING | UNIT_STATE_ROAMING_MOVE);
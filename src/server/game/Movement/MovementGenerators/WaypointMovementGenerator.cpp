@@ -94,6 +94,8 @@ void WaypointMovementGenerator<Creature>::OnArrived(Creature* creature)
     }
 }
 
+#define BAKED_SEGMENT_START_DISTANCE 3.0f
+
 bool WaypointMovementGenerator<Creature>::StartMove(Creature* creature)
 {
     if (!i_path || i_path->empty())
@@ -169,11 +171,25 @@ bool WaypointMovementGenerator<Creature>::StartMove(Creature* creature)
             trans->CalculatePassengerPosition(formationDest.x, formationDest.y, formationDest.z, &formationDest.orientation);
     }
 
-    float z = node->z;
-    creature->UpdateAllowedPositionZ(node->x, node->y, z);
-    //! Do not use formationDest here, MoveTo requires transport offsets due to DisableTransportPathTransformations() call
-    //! but formationDest contains global coordinates
-    init.MoveTo(node->x, node->y, z, true, true);
+    //! Corridors baked by waypoint_baker start at the previous node, they are only followed from there
+    //! and only by creatures whose path filter allows the terrain the corridor crosses
+    WaypointBakedSegment const* bakedSegment = nullptr;
+    if (!transportPath && !creature->CanFly() && node->move_type != WAYPOINT_MOVE_TYPE_LAND && node->move_type != WAYPOINT_MOVE_TYPE_TAKEOFF)
+        if (WaypointBakedSegment const* segment = sWaypointMgr->GetBakedSegment(path_id, i_currentNode))
+            if ((!(segment->NavFlags & NAV_GROUND) || creature->CanWalk()) && (!(segment->NavFlags & NAV_WATER) || creature->CanEnterWater())
+                && creature->GetExactDist2dSq(segment->Points.front().x, segment->Points.front().y) < BAKED_SEGMENT_START_DISTANCE * BAKED_SEGMENT_START_DISTANCE)
+                bakedSegment = segment;
+
+    if (bakedSegment)
+        init.MovebyPath(bakedSegment->Points);
+    else
+    {
+        float z = node->z;
+        creature->UpdateAllowedPositionZ(node->x, node->y, z);
+        //! Do not use formationDest here, MoveTo requires transport offsets due to DisableTransportPathTransformations() call
+        //! but formationDest contains global coordinates
+        init.MoveTo(node->x, node->y, z, true, true);
+    }
 
     if (node->orientation.has_value() && node->delay > 0)
         init.SetFacing(*node->orientation);
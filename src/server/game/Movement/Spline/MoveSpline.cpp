@@ -18,6 +18,7 @@
 #include "MoveSpline.h"
 #include "Creature.h"
 #include "Log.h"
+#include "SplineSegmentCache.h"
 #include <sstream>
 
 namespace Movement
@@ -107,16 +108,20 @@ namespace Movement
 
     struct CommonInitializer
     {
-        CommonInitializer(float _velocity) : velocityInv(1000.f / _velocity), _time(minimal_duration) {}
+        CommonInitializer(float _velocity, std::shared_ptr<SplineSegmentLengths const> _cached) : velocityInv(1000.f / _velocity), _time(minimal_duration), cached(std::move(_cached)) {}
 
         inline int32 operator()(Spline<int32>& s, int32 i)
         {
-            _time += (s.SegLength(i) * velocityInv);
+            if (cached && i >= cached->First && i < cached->First + int32(cached->Lengths.size()))
+                _time += (cached->Lengths[i - cached->First] * velocityInv);
+            else
+                _time += (s.SegLength(i) * velocityInv);
             return _time;
         }
 
         float velocityInv;
         int32 _time;
+        std::shared_ptr<SplineSegmentLengths const> cached;
     };
 
     void MoveSpline::init_spline(const MoveSplineInitArgs& args)
@@ -143,7 +148,7 @@ namespace Movement
         }
         else
         {
-            CommonInitializer init(args.velocity);
+            CommonInitializer init(args.velocity, sSplineSegmentCache->GetSegmentLengths(spline));
             spline.initLengths(init);
         }
 
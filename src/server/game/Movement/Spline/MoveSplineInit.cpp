@@ -16,6 +16,9 @@
  */
 
 #include "MoveSplineInit.h"
+#include "CellImpl.h"
+#include "GridNotifiers.h"
+#include "GridNotifiersImpl.h"
 #include "MoveSpline.h"
 #include "MovementPacketBuilder.h"
 #include "Opcodes.h"
@@ -136,7 +139,10 @@ namespace Movement
         }
 
         PacketBuilder::WriteMonsterMove(move_spline, data);
-        unit->SendMessageToSet(&data, true);
+
+        MonsterMoveBatch* batch = MonsterMoveBatch::GetActive();
+        if (!batch || !batch->Add(unit, std::move(data)))
+            unit->SendMessageToSet(&data, true);
 
         return move_spline.Duration();
     }
@@ -233,6 +239,52 @@ namespace Movement
         args.path[1] = transform(dest);
     }
 
+    thread_local MonsterMoveBatch* MonsterMoveBatch::_active = nullptr;
+
+    MonsterMoveBatch::MonsterMoveBatch(WorldObject const* center) : _center(center), _previous(_active)
+    {
+        _active = this;
+    }
+
+    MonsterMoveBatch::~MonsterMoveBatch()
+    {
+        _active = _previous;
+
+        if (_packets.empty())
+            return;
+
+        if (_packets.size() == 1)
+        {
+            _packets.front().first->SendMessageToSet(&_packets.front().second, true);
+            return;
+        }
+
+        // same range as WorldObject::SendMessageToSet for every packet, the visit covers all of them
+        std::vector<Acore::MessageDistDeliverer> deliverers;
+        deliverers.reserve(_packets.size());
+        float visitRange = 0.0f;
+        for (auto const& [source, packet] : _packets)
+        {
+            float range = source->GetVisibilityRange() + source->GetObjectSize() + VISIBILITY_COMPENSATION;
+            deliverers.emplace_back(source, &packet, range);
+            visitRange = std::max(visitRange, _center->GetExactDist2d(source) + range);
+        }
+
+        Acore::MessageDistDelivererBatch notifier(deliverers);
+        Cell::VisitWorldObjects(_center, notifier, visitRange);
+    }
+
+    bool MonsterMoveBatch::Add(Unit const* unit, WorldPacket&& packet)
+    {
+        // players also receive their own moves, transport moves are relative to the transport
+        if (unit->GetTypeId() != TYPEID_UNIT || packet.GetOpcode() != SMSG_MONSTER_MOVE || !unit->IsInWorld() ||
+            !_center->IsInWorld() || unit->GetMap() != _center->GetMap())
+            return false;
+
+        _packets.emplace_back(unit, std::move(packet));
+        return true;
+    }
+
     Vector3 TransportPathTransform::operator()(Vector3 input)
     {
         if (_transformForTransport)
@@ -161,6 +161,33 @@ namespace Movement
         Unit*  unit;
     };
 
+    /*  Collects the monster move packets of creatures launched while it is in scope and sends them
+        with a single grid visit around center when it goes out of scope. Every packet still reaches
+        exactly the players it would have reached on its own.
+     */
+    class MonsterMoveBatch
+    {
+    public:
+        explicit MonsterMoveBatch(WorldObject const* center);
+        ~MonsterMoveBatch();
+
+        MonsterMoveBatch(MonsterMoveBatch const&) = delete;
+        MonsterMoveBatch& operator=(MonsterMoveBatch const&) = delete;
+
+        /// Batch the current thread collects into, nullptr if none
+        static MonsterMoveBatch* GetActive() { return _active; }
+
+        /// false if the packet has to be sent on its own
+        bool Add(Unit const* unit, WorldPacket&& packet);
+
+    private:
+        WorldObject const* _center;
+        std::vector<std::pair<Unit const*, WorldPacket>> _packets;
+        MonsterMoveBatch* _previous;
+
+        static thread_local MonsterMoveBatch* _active;
+    };
+
     inline void MoveSplineInit::SetFly() { args.flags.EnableFlying(); }
     inline void MoveSplineInit::SetWalk(bool enable) { args.flags.walkmode = enable; }
     inline void MoveSplineInit::SetSmooth() { args.flags.EnableCatmullRom(); }
@@ -0,0 +1,83 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SplineSegmentCache.h"
+#include <cstring>
+#include <mutex>
+
+namespace Movement
+{
+    enum
+    {
+        MIN_CACHED_SEGMENTS = 8,                        // shorter paths are computed faster than they are looked up
+        MAX_CACHED_PATHS    = 4096
+    };
+
+    SplineSegmentCache* SplineSegmentCache::instance()
+    {
+        static SplineSegmentCache instance;
+        return &instance;
+    }
+
+    std::shared_ptr<SplineSegmentLengths const> SplineSegmentCache::GetSegmentLengths(Spline<int32> const& spline)
+    {
+        if (spline.mode() != SplineBase::ModeCatmullrom)
+            return nullptr;
+
+        // segment i reads points [i - 1, i + 2], the first control point is stored at index 1
+        // and, for cyclic splines, repeated after the last one
+        SplineBase::index_type first = spline.first() + 2;
+        SplineBase::index_type last = spline.isCyclic() ? spline.last() - 2 : spline.last();
+        if (last - first < MIN_CACHED_SEGMENTS)
+            return nullptr;
+
+        Vector3 const* points = &spline.getPoint(first - 1);
+        std::size_t pointCount = last - first + 3;
+
+        // FNV-1a over the raw coordinates
+        uint64 key = 14695981039346656037ULL;
+        uint8 const* bytes = reinterpret_cast<uint8 const*>(points);
+        for (std::size_t i = 0; i < pointCount * sizeof(Vector3); ++i)
+        {
+            key ^= bytes[i];
+            key *= 1099511628211ULL;
+        }
+
+        {
+            std::shared_lock<std::shared_mutex> lock(_lock);
+            auto itr = _entries.find(key);
+            if (itr != _entries.end() && itr->second->First == first && itr->second->Points.size() == pointCount &&
+                !std::memcmp(itr->second->Points.data(), points, pointCount * sizeof(Vector3)))
+                return itr->second;
+        }
+
+        std::shared_ptr<SplineSegmentLengths> entry = std::make_shared<SplineSegmentLengths>();
+        entry->First = first;
+        entry->Points.assign(points, points + pointCount);
+        entry->Lengths.reserve(last - first);
+        for (SplineBase::index_type i = first; i < last; ++i)
+            entry->Lengths.push_back(spline.SegLength(i));
+
+        std::unique_lock<std::shared_mutex> lock(_lock);
+        // paths are static data, a full cache only happens with generated paths and is simply started over
+        if (_entries.size() >= MAX_CACHED_PATHS)
+            _entries.clear();
+
+        _entries[key] = entry;
+        return entry;
+    }
+}
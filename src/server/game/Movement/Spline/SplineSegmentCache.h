@@ -0,0 +1,55 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITYSERVER_SPLINESEGMENTCACHE_H
+#define TRINITYSERVER_SPLINESEGMENTCACHE_H
+
+#include "Spline.h"
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace Movement
+{
+    struct SplineSegmentLengths
+    {
+        SplineBase::index_type First;                   // spline index of Lengths[0]
+        std::vector<float> Lengths;
+        SplineBase::ControlArray Points;                // points read by the cached segments, compared on every hit
+    };
+
+    /*  Shares the Catmull-Rom segment lengths of long paths (taxi routes, smooth waypoint and escort paths)
+        between all splines launched on them. Segments reading the first control point are never cached,
+        it is the position of the moving unit and differs on every launch.
+     */
+    class SplineSegmentCache
+    {
+    public:
+        static SplineSegmentCache* instance();
+
+        /// Lengths of the cacheable segments of spline, nullptr when it is too short to be worth it
+        std::shared_ptr<SplineSegmentLengths const> GetSegmentLengths(Spline<int32> const& spline);
+
+    private:
+        std::unordered_map<uint64, std::shared_ptr<SplineSegmentLengths const>> _entries;
+        std::shared_mutex _lock;
+    };
+}
+
+#define sSplineSegmentCache Movement::SplineSegmentCache::instance()
+
+#endif // TRINITYSERVER_SPLINESEGMENTCACHE_H
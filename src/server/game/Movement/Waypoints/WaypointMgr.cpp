@@ -19,6 +19,30 @@
 #include "DatabaseEnv.h"
 #include "GridDefines.h"
 #include "Log.h"
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+    constexpr char BakedMagic[4] = { 'W', 'P', 'B', 'K' };
+    constexpr uint32 BakedVersion = 2;                     // keep in sync with tools/waypoint_baker
+
+    constexpr float BAKED_NODE_TOLERANCE = 0.5f;
+
+    bool MatchesNode(WaypointData const* node, float const* position)
+    {
+        return std::fabs(node->x - position[0]) < BAKED_NODE_TOLERANCE
+            && std::fabs(node->y - position[1]) < BAKED_NODE_TOLERANCE
+            && std::fabs(node->z - position[2]) < BAKED_NODE_TOLERANCE;
+    }
+
+    template<typename T>
+    bool Read(std::ifstream& file, T& value)
+    {
+        return bool(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+}
 
 WaypointMgr::WaypointMgr()
 {
@@ -103,8 +127,94 @@ void WaypointMgr::Load()
     LOG_INFO("server.loading", " ");
 }
 
+void WaypointMgr::LoadBakedPaths(std::string const& fileName)
+{
+    _bakedPathStore.clear();
+
+    if (fileName.empty())
+        return;
+
+    uint32 oldMSTime = getMSTime();
+
+    std::ifstream file(fileName, std::ios::in | std::ios::binary);
+    char magic[4];
+    uint32 version = 0;
+    uint32 pathCount = 0;
+    if (!file || !file.read(magic, sizeof(magic)) || std::memcmp(magic, BakedMagic, sizeof(BakedMagic)) != 0 || !Read(file, version) || version != BakedVersion || !Read(file, pathCount))
+    {
+        LOG_ERROR("server.loading", ">> Baked waypoint file '{}' is missing or was written by another waypoint_baker version, waypoints are pathed at runtime.", fileName);
+        LOG_INFO("server.loading", " ");
+        return;
+    }
+
+    uint32 segmentCount = 0;
+    uint32 staleCount = 0;
+    for (uint32 i = 0; i < pathCount; ++i)
+    {
+        uint32 pathId, mapId, nodeCount;
+        if (!Read(file, pathId) || !Read(file, mapId) || !Read(file, nodeCount))
+        {
+            LOG_ERROR("server.loading", ">> Baked waypoint file '{}' is truncated, waypoints are pathed at runtime.", fileName);
+            _bakedPathStore.clear();
+            return;
+        }
+
+        WaypointPath const* path = GetPath(pathId);
+        std::vector<WaypointBakedSegment> segments(nodeCount);
+        bool baked = false;
+        for (uint32 node = 0; node < nodeCount; ++node)
+        {
+            float nodes[6];
+            uint32 navFlags, pointCount;
+            if (!Read(file, nodes) || !Read(file, navFlags) || !Read(file, pointCount))
+            {
+                LOG_ERROR("server.loading", ">> Baked waypoint file '{}' is truncated, waypoints are pathed at runtime.", fileName);
+                _bakedPathStore.clear();
+                return;
+            }
+
+            WaypointBakedSegment& segment = segments[node];
+            segment.NavFlags = uint16(navFlags);
+            segment.Points.resize(pointCount);
+            for (G3D::Vector3& point : segment.Points)
+                if (!Read(file, point.x) || !Read(file, point.y) || !Read(file, point.z))
+                    break;
+
+            if (!pointCount)
+                continue;
+
+            // the path was edited after baking, those nodes are pathed at runtime again
+            if (!path || path->size() != nodeCount || !MatchesNode((*path)[node ? node - 1 : nodeCount - 1], &nodes[0]) || !MatchesNode((*path)[node], &nodes[3]))
+            {
+                segment.Points.clear();
+                ++staleCount;
+                continue;
+            }
+
+            ++segmentCount;
+            baked = true;
+        }
+
+        if (baked)
+            _bakedPathStore[pathId] = std::move(segments);
+    }
+
+    if (!file)
+    {
+        LOG_ERROR("server.loading", ">> Baked waypoint file '{}' is truncated, waypoints are pathed at runtime.", fileName);
+        _bakedPathStore.clear();
+        return;
+    }
+
+    LOG_INFO("server.loading", ">> Loaded {} baked waypoint segments of {} paths ({} stale segments ignored) in {} ms", segmentCount, _bakedPathStore.size(), staleCount, GetMSTimeDiffToNow(oldMSTime));
+    LOG_INFO("server.loading", " ");
+}
+
 void WaypointMgr::ReloadPath(uint32 id)
 {
+    // the baked corridors were checked against the old nodes
+    _bakedPathStore.erase(id);
+
     WaypointPathContainer::iterator itr = _waypointStore.find(id);
     if (itr != _waypointStore.end())
     {
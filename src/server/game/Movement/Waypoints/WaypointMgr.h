@@ -19,6 +19,7 @@
 #define ACORE_WAYPOINTMANAGER_H
 
 #include "Common.h"
+#include <G3D/Vector3.h>
 #include <unordered_map>
 #include <vector>
 
@@ -46,6 +47,15 @@ struct WaypointData
 typedef std::vector<WaypointData*> WaypointPath;
 typedef std::unordered_map<uint32, WaypointPath> WaypointPathContainer;
 
+// Navmesh corridor from the previous node to a node, written by the waypoint_baker tool
+struct WaypointBakedSegment
+{
+    std::vector<G3D::Vector3> Points;
+    uint16 NavFlags = 0;                                   // NavTerrainFlag of the polygons the corridor crosses
+};
+
+typedef std::unordered_map<uint32, std::vector<WaypointBakedSegment>> WaypointBakedPathContainer;
+
 class WaypointMgr
 {
 public:
@@ -57,6 +67,9 @@ public:
     // Loads all paths from database, should only run on startup
     void Load();
 
+    // Loads the corridors baked by waypoint_baker, must run after Load() to drop segments of changed paths
+    void LoadBakedPaths(std::string const& fileName);
+
     // Returns the path from a given id
     WaypointPath const* GetPath(uint32 id) const
     {
@@ -67,11 +80,22 @@ public:
         return nullptr;
     }
 
+    // Returns the baked corridor leading to the node at nodeIndex, the first node is reached from the last one
+    WaypointBakedSegment const* GetBakedSegment(uint32 id, uint32 nodeIndex) const
+    {
+        WaypointBakedPathContainer::const_iterator itr = _bakedPathStore.find(id);
+        if (itr != _bakedPathStore.end() && nodeIndex < itr->second.size() && !itr->second[nodeIndex].Points.empty())
+            return &itr->second[nodeIndex];
+
+        return nullptr;
+    }
+
 private:
     WaypointMgr();
     ~WaypointMgr();
 
     WaypointPathContainer _waypointStore;
+    WaypointBakedPathContainer _bakedPathStore;
 };
 
 #define sWaypointMgr WaypointMgr::instance()
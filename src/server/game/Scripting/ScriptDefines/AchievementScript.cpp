@@ -56,11 +56,17 @@ bool ScriptMgr::IsRealmCompleted(AchievementGlobalMgr const* globalmgr, Achievem
     return true;
 }
 
-void ScriptMgr::OnBeforeCheckCriteria(AchievementMgr* mgr, AchievementCriteriaEntryList const* achievementCriteriaList)
+void ScriptMgr::OnBeforeCheckCriteria(AchievementMgr* mgr, AchievementCriteriaEntryVector const* achievementCriteriaList)
 {
+    if (ScriptRegistry<AchievementScript>::ScriptPointerList.empty())
+        return;
+
+    // the hook still takes a std::list, only build it when there is a script to read it
+    AchievementCriteriaEntryList const criteriaList(achievementCriteriaList->begin(), achievementCriteriaList->end());
+
     ExecuteScript<AchievementScript>([&](AchievementScript* script)
     {
-        script->OnBeforeCheckCriteria(mgr, achievementCriteriaList);
+        script->OnBeforeCheckCriteria(mgr, &criteriaList);
     });
 }
 
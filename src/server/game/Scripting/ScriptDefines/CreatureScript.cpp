@@ -183,7 +183,7 @@ void ScriptMgr::OnCreatureUpdate(Creature* creature, uint32 diff)
 {
     ASSERT(creature);
 
-    ExecuteScript<AllCreatureScript>([&](AllCreatureScript* script)
+    ExecuteHook<AllCreatureScript>(ALLCREATUREHOOK_ON_ALL_CREATURE_UPDATE, [&](AllCreatureScript* script)
     {
         script->OnAllCreatureUpdate(creature, diff);
     });
@@ -299,7 +299,7 @@ void ScriptMgr::OnPlayerSpellCast(Player* player, Spell* spell, bool skipCheck)
 
 void ScriptMgr::OnBeforePlayerUpdate(Player* player, uint32 p_time)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteHook<PlayerScript>(PLAYERHOOK_ON_BEFORE_UPDATE, [&](PlayerScript* script)
     {
         script->OnBeforeUpdate(player, p_time);
     });
@@ -307,7 +307,7 @@ void ScriptMgr::OnBeforePlayerUpdate(Player* player, uint32 p_time)
 
 void ScriptMgr::OnPlayerUpdate(Player* player, uint32 p_time)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteHook<PlayerScript>(PLAYERHOOK_ON_UPDATE, [&](PlayerScript* script)
     {
         script->OnUpdate(player, p_time);
     });
@@ -315,7 +315,7 @@ void ScriptMgr::OnPlayerUpdate(Player* player, uint32 p_time)
 
 void ScriptMgr::OnAfterPlayerUpdate(Player* player, uint32 diff)
 {
-    ExecuteScript<PlayerScript>([&](PlayerScript* script)
+    ExecuteHook<PlayerScript>(PLAYERHOOK_ON_AFTER_UPDATE, [&](PlayerScript* script)
     {
         script->OnAfterUpdate(player, diff);
     });
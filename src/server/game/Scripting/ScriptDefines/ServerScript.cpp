@@ -56,12 +56,13 @@ void ScriptMgr::OnSocketClose(std::shared_ptr<WorldSocket> socket)
 
 bool ScriptMgr::CanPacketReceive(WorldSession* session, WorldPacket const& packet)
 {
-    if (ScriptRegistry<ServerScript>::ScriptPointerList.empty())
+    // only copy the packet when a script will look at it
+    if (!HasHookSubscribers<ServerScript>(SERVERHOOK_CAN_PACKET_RECEIVE))
         return true;
 
     WorldPacket copy(packet);
 
-    auto ret = IsValidBoolScript<ServerScript>([&](ServerScript* script)
+    auto ret = IsValidBoolHook<ServerScript>(SERVERHOOK_CAN_PACKET_RECEIVE, [&](ServerScript* script)
     {
         return !script->CanPacketReceive(session, copy);
     });
@@ -76,8 +77,11 @@ bool ScriptMgr::CanPacketReceive(WorldSession* session, WorldPacket const& packe
 
 void ScriptMgr::OnPacketReceived(WorldSession* session, WorldPacket const& packet)
 {
+    if (!HasHookSubscribers<ServerScript>(SERVERHOOK_ON_PACKET_RECEIVED))
+        return;
+
     WorldPacket copy(packet);
-    ExecuteScript<ServerScript>([&](ServerScript* script)
+    ExecuteHook<ServerScript>(SERVERHOOK_ON_PACKET_RECEIVED, [&](ServerScript* script)
     {
         script->OnPacketReceived(session, copy);
     });
@@ -87,12 +91,13 @@ bool ScriptMgr::CanPacketSend(WorldSession* session, WorldPacket const& packet)
 {
     ASSERT(session);
 
-    if (ScriptRegistry<ServerScript>::ScriptPointerList.empty())
+    // only copy the packet when a script will look at it
+    if (!HasHookSubscribers<ServerScript>(SERVERHOOK_CAN_PACKET_SEND))
         return true;
 
     WorldPacket copy(packet);
 
-    auto ret = IsValidBoolScript<ServerScript>([&](ServerScript* script)
+    auto ret = IsValidBoolHook<ServerScript>(SERVERHOOK_CAN_PACKET_SEND, [&](ServerScript* script)
     {
         return !script->CanPacketSend(session, copy);
     });
@@ -20,12 +20,7 @@
 
 uint32 ScriptMgr::DealDamage(Unit* AttackerUnit, Unit* pVictim, uint32 damage, DamageEffectType damagetype)
 {
-    if (ScriptRegistry<UnitScript>::ScriptPointerList.empty())
-    {
-        return damage;
-    }
-
-    for (auto const& [scriptID, script] : ScriptRegistry<UnitScript>::ScriptPointerList)
+    for (UnitScript* script : ScriptRegistry<UnitScript>::EnabledHooks[UNITHOOK_DEAL_DAMAGE])
     {
         auto const& dmg = script->DealDamage(AttackerUnit, pVictim, damage, damagetype);
         if (dmg != damage)
@@ -39,7 +34,7 @@ uint32 ScriptMgr::DealDamage(Unit* AttackerUnit, Unit* pVictim, uint32 damage, D
 
 void ScriptMgr::OnHeal(Unit* healer, Unit* reciever, uint32& gain)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteHook<UnitScript>(UNITHOOK_ON_HEAL, [&](UnitScript* script)
     {
         script->OnHeal(healer, reciever, gain);
     });
@@ -47,7 +42,7 @@ void ScriptMgr::OnHeal(Unit* healer, Unit* reciever, uint32& gain)
 
 void ScriptMgr::OnDamage(Unit* attacker, Unit* victim, uint32& damage)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteHook<UnitScript>(UNITHOOK_ON_DAMAGE, [&](UnitScript* script)
     {
         script->OnDamage(attacker, victim, damage);
     });
@@ -55,7 +50,7 @@ void ScriptMgr::OnDamage(Unit* attacker, Unit* victim, uint32& damage)
 
 void ScriptMgr::ModifyPeriodicDamageAurasTick(Unit* target, Unit* attacker, uint32& damage, SpellInfo const* spellInfo)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteHook<UnitScript>(UNITHOOK_MODIFY_PERIODIC_DAMAGE_AURAS_TICK, [&](UnitScript* script)
     {
         script->ModifyPeriodicDamageAurasTick(target, attacker, damage, spellInfo);
     });
@@ -63,7 +58,7 @@ void ScriptMgr::ModifyPeriodicDamageAurasTick(Unit* target, Unit* attacker, uint
 
 void ScriptMgr::ModifyMeleeDamage(Unit* target, Unit* attacker, uint32& damage)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteHook<UnitScript>(UNITHOOK_MODIFY_MELEE_DAMAGE, [&](UnitScript* script)
     {
         script->ModifyMeleeDamage(target, attacker, damage);
     });
@@ -71,7 +66,7 @@ void ScriptMgr::ModifyMeleeDamage(Unit* target, Unit* attacker, uint32& damage)
 
 void ScriptMgr::ModifySpellDamageTaken(Unit* target, Unit* attacker, int32& damage, SpellInfo const* spellInfo)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteHook<UnitScript>(UNITHOOK_MODIFY_SPELL_DAMAGE_TAKEN, [&](UnitScript* script)
     {
         script->ModifySpellDamageTaken(target, attacker, damage, spellInfo);
     });
@@ -79,7 +74,7 @@ void ScriptMgr::ModifySpellDamageTaken(Unit* target, Unit* attacker, int32& dama
 
 void ScriptMgr::ModifyHealReceived(Unit* target, Unit* healer, uint32& heal, SpellInfo const* spellInfo)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteHook<UnitScript>(UNITHOOK_MODIFY_HEAL_RECEIVED, [&](UnitScript* script)
     {
         script->ModifyHealReceived(target, healer, heal, spellInfo);
     });
@@ -87,7 +82,7 @@ void ScriptMgr::ModifyHealReceived(Unit* target, Unit* healer, uint32& heal, Spe
 
 void ScriptMgr::OnBeforeRollMeleeOutcomeAgainst(Unit const* attacker, Unit const* victim, WeaponAttackType attType, int32& attackerMaxSkillValueForLevel, int32& victimMaxSkillValueForLevel, int32& attackerWeaponSkill, int32& victimDefenseSkill, int32& crit_chance, int32& miss_chance, int32& dodge_chance, int32& parry_chance, int32& block_chance)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteHook<UnitScript>(UNITHOOK_ON_BEFORE_ROLL_MELEE_OUTCOME_AGAINST, [&](UnitScript* script)
     {
         script->OnBeforeRollMeleeOutcomeAgainst(attacker, victim, attType, attackerMaxSkillValueForLevel, victimMaxSkillValueForLevel, attackerWeaponSkill, victimDefenseSkill, crit_chance, miss_chance, dodge_chance, parry_chance, block_chance);
     });
@@ -118,7 +113,7 @@ bool ScriptMgr::IfNormalReaction(Unit const* unit, Unit const* target, Reputatio
 
 bool ScriptMgr::IsNeedModSpellDamagePercent(Unit const* unit, AuraEffect* auraEff, float& doneTotalMod, SpellInfo const* spellProto)
 {
-    auto ret = IsValidBoolScript<UnitScript>([&](UnitScript* script)
+    auto ret = IsValidBoolHook<UnitScript>(UNITHOOK_IS_NEED_MOD_SPELL_DAMAGE_PERCENT, [&](UnitScript* script)
     {
         return !script->IsNeedModSpellDamagePercent(unit, auraEff, doneTotalMod, spellProto);
     });
@@ -133,7 +128,7 @@ bool ScriptMgr::IsNeedModSpellDamagePercent(Unit const* unit, AuraEffect* auraEf
 
 bool ScriptMgr::IsNeedModMeleeDamagePercent(Unit const* unit, AuraEffect* auraEff, float& doneTotalMod, SpellInfo const* spellProto)
 {
-    auto ret = IsValidBoolScript<UnitScript>([&](UnitScript* script)
+    auto ret = IsValidBoolHook<UnitScript>(UNITHOOK_IS_NEED_MOD_MELEE_DAMAGE_PERCENT, [&](UnitScript* script)
     {
         return !script->IsNeedModMeleeDamagePercent(unit, auraEff, doneTotalMod, spellProto);
     });
@@ -148,7 +143,7 @@ bool ScriptMgr::IsNeedModMeleeDamagePercent(Unit const* unit, AuraEffect* auraEf
 
 bool ScriptMgr::IsNeedModHealPercent(Unit const* unit, AuraEffect* auraEff, float& doneTotalMod, SpellInfo const* spellProto)
 {
-    auto ret = IsValidBoolScript<UnitScript>([&](UnitScript* script)
+    auto ret = IsValidBoolHook<UnitScript>(UNITHOOK_IS_NEED_MOD_HEAL_PERCENT, [&](UnitScript* script)
     {
         return !script->IsNeedModHealPercent(unit, auraEff, doneTotalMod, spellProto);
     });
@@ -205,7 +200,7 @@ bool ScriptMgr::OnBuildValuesUpdate(Unit const* unit, uint8 updateType, ByteBuff
 
 void ScriptMgr::OnUnitUpdate(Unit* unit, uint32 diff)
 {
-    ExecuteScript<UnitScript>([&](UnitScript* script)
+    ExecuteHook<UnitScript>(UNITHOOK_ON_UNIT_UPDATE, [&](UnitScript* script)
     {
         script->OnUnitUpdate(unit, diff);
     });
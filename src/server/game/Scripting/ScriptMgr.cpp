@@ -37,6 +37,19 @@ namespace
         }
 
         ScriptRegistry<T>::ScriptPointerList.clear();
+
+        for (auto& subscribers : ScriptRegistry<T>::EnabledHooks)
+            subscribers.clear();
+    }
+
+    template<typename T>
+    void LogHookSubscribers(std::string_view scriptType, std::array<std::string_view, ScriptHookCount<T>::value> const& hookNames)
+    {
+        std::string counts;
+        for (std::size_t hook = 0; hook < hookNames.size(); ++hook)
+            counts += Acore::StringFormat("{}{} {}", hook ? ", " : "", hookNames[hook], ScriptRegistry<T>::EnabledHooks[hook].size());
+
+        LOG_INFO("server.loading", ">> {} hook subscribers of {} scripts: {}", scriptType, ScriptRegistry<T>::ScriptPointerList.size(), counts);
     }
 }
 
@@ -162,6 +175,13 @@ void ScriptMgr::LoadDatabase()
     CheckIfScriptsInDatabaseExist();
 
     LOG_INFO("server.loading", ">> Loaded {} C++ scripts in {} ms", GetScriptCount(), GetMSTimeDiffToNow(oldMSTime));
+
+    LogHookSubscribers<ServerScript>("ServerScript", { "CanPacketSend", "CanPacketReceive", "OnPacketReceived" });
+    LogHookSubscribers<UnitScript>("UnitScript", { "OnHeal", "OnDamage", "ModifyPeriodicDamageAurasTick", "ModifyMeleeDamage",
+        "ModifySpellDamageTaken", "ModifyHealReceived", "DealDamage", "OnBeforeRollMeleeOutcomeAgainst", "IsNeedModSpellDamagePercent",
+        "IsNeedModMeleeDamagePercent", "IsNeedModHealPercent", "OnUnitUpdate" });
+    LogHookSubscribers<AllCreatureScript>("AllCreatureScript", { "OnAllCreatureUpdate" });
+    LogHookSubscribers<PlayerScript>("PlayerScript", { "OnBeforeUpdate", "OnUpdate", "OnAfterUpdate" });
     LOG_INFO("server.loading", " ");
 }
 
@@ -313,6 +333,12 @@ AllCreatureScript::AllCreatureScript(const char* name)
     ScriptRegistry<AllCreatureScript>::AddScript(this);
 }
 
+AllCreatureScript::AllCreatureScript(const char* name, std::vector<uint16> enabledHooks)
+    : ScriptObject(name)
+{
+    ScriptRegistry<AllCreatureScript>::AddScript(this, std::move(enabledHooks));
+}
+
 UnitScript::UnitScript(const char* name, bool addToScripts)
     : ScriptObject(name)
 {
@@ -320,6 +346,13 @@ UnitScript::UnitScript(const char* name, bool addToScripts)
         ScriptRegistry<UnitScript>::AddScript(this);
 }
 
+UnitScript::UnitScript(const char* name, bool addToScripts, std::vector<uint16> enabledHooks)
+    : ScriptObject(name)
+{
+    if (addToScripts)
+        ScriptRegistry<UnitScript>::AddScript(this, std::move(enabledHooks));
+}
+
 MovementHandlerScript::MovementHandlerScript(const char* name)
     : ScriptObject(name)
 {
@@ -338,6 +371,12 @@ ServerScript::ServerScript(const char* name)
     ScriptRegistry<ServerScript>::AddScript(this);
 }
 
+ServerScript::ServerScript(const char* name, std::vector<uint16> enabledHooks)
+    : ScriptObject(name)
+{
+    ScriptRegistry<ServerScript>::AddScript(this, std::move(enabledHooks));
+}
+
 WorldScript::WorldScript(const char* name)
     : ScriptObject(name)
 {
@@ -488,6 +527,12 @@ PlayerScript::PlayerScript(const char* name)
     ScriptRegistry<PlayerScript>::AddScript(this);
 }
 
+PlayerScript::PlayerScript(const char* name, std::vector<uint16> enabledHooks)
+    : ScriptObject(name)
+{
+    ScriptRegistry<PlayerScript>::AddScript(this, std::move(enabledHooks));
+}
+
 AccountScript::AccountScript(const char* name)
     : ScriptObject(name)
 {
@@ -37,6 +37,7 @@
 #include "Types.h"
 #include "Weather.h"
 #include "World.h"
+#include <array>
 #include <atomic>
 
 class AuctionHouseObject;
@@ -106,6 +107,48 @@ namespace Acore::ChatCommands
 
 */
 
+// Hooks that are only dispatched to the scripts subscribed to them (ScriptRegistry::EnabledHooks).
+// A script passes the hooks it implements to its script type constructor, scripts using the constructor
+// without that list are subscribed to all of them. Hooks not listed here are called on every script of the type.
+enum ServerHook
+{
+    SERVERHOOK_CAN_PACKET_SEND,
+    SERVERHOOK_CAN_PACKET_RECEIVE,
+    SERVERHOOK_ON_PACKET_RECEIVED,
+    SERVERHOOK_END
+};
+
+enum UnitHook
+{
+    UNITHOOK_ON_HEAL,
+    UNITHOOK_ON_DAMAGE,
+    UNITHOOK_MODIFY_PERIODIC_DAMAGE_AURAS_TICK,
+    UNITHOOK_MODIFY_MELEE_DAMAGE,
+    UNITHOOK_MODIFY_SPELL_DAMAGE_TAKEN,
+    UNITHOOK_MODIFY_HEAL_RECEIVED,
+    UNITHOOK_DEAL_DAMAGE,
+    UNITHOOK_ON_BEFORE_ROLL_MELEE_OUTCOME_AGAINST,
+    UNITHOOK_IS_NEED_MOD_SPELL_DAMAGE_PERCENT,
+    UNITHOOK_IS_NEED_MOD_MELEE_DAMAGE_PERCENT,
+    UNITHOOK_IS_NEED_MOD_HEAL_PERCENT,
+    UNITHOOK_ON_UNIT_UPDATE,
+    UNITHOOK_END
+};
+
+enum AllCreatureHook
+{
+    ALLCREATUREHOOK_ON_ALL_CREATURE_UPDATE,
+    ALLCREATUREHOOK_END
+};
+
+enum PlayerHook
+{
+    PLAYERHOOK_ON_BEFORE_UPDATE,
+    PLAYERHOOK_ON_UPDATE,
+    PLAYERHOOK_ON_AFTER_UPDATE,
+    PLAYERHOOK_END
+};
+
 class ScriptObject
 {
     friend class ScriptMgr;
@@ -159,6 +202,7 @@ class ServerScript : public ScriptObject
 {
 protected:
     ServerScript(const char* name);
+    ServerScript(const char* name, std::vector<uint16> enabledHooks);
 
 public:
     // Called when reactive socket I/O is started (WorldSocketMgr).
@@ -416,6 +460,7 @@ class UnitScript : public ScriptObject
 {
 protected:
     UnitScript(const char* name, bool addToScripts = true);
+    UnitScript(const char* name, bool addToScripts, std::vector<uint16> enabledHooks);
 
 public:
     // Called when a unit deals healing to another unit
@@ -553,6 +598,7 @@ class AllCreatureScript : public ScriptObject
 {
 protected:
     AllCreatureScript(const char* name);
+    AllCreatureScript(const char* name, std::vector<uint16> enabledHooks);
 
 public:
     // Called from End of Creature Update.
@@ -990,6 +1036,7 @@ class PlayerScript : public ScriptObject
 {
 protected:
     PlayerScript(const char* name);
+    PlayerScript(const char* name, std::vector<uint16> enabledHooks);
 
 public:
     virtual void OnPlayerReleasedGhost(Player* /*player*/) { }
@@ -2580,7 +2627,7 @@ public: /* AchievementScript */
     void SetRealmCompleted(AchievementEntry const* achievement);
     bool IsCompletedCriteria(AchievementMgr* mgr, AchievementCriteriaEntry const* achievementCriteria, AchievementEntry const* achievement, CriteriaProgress const* progress);
     bool IsRealmCompleted(AchievementGlobalMgr const* globalmgr, AchievementEntry const* achievement, std::chrono::system_clock::time_point completionTime);
-    void OnBeforeCheckCriteria(AchievementMgr* mgr, AchievementCriteriaEntryList const* achievementCriteriaList);
+    void OnBeforeCheckCriteria(AchievementMgr* mgr, AchievementCriteriaEntryVector const* achievementCriteriaList);
     bool CanCheckCriteria(AchievementMgr* mgr, AchievementCriteriaEntry const* achievementCriteria);
 
 public: /* PetScript */
@@ -2765,6 +2812,13 @@ template <class AI, AI* (*AIFactory)(GameObject*)> class FactoryGameObjectScript
 
 #define sScriptMgr ScriptMgr::instance()
 
+// Number of entries of the hook enum of a script type, 0 for types without per hook dispatch
+template<class TScript> struct ScriptHookCount { static constexpr uint16 value = 0; };
+template<> struct ScriptHookCount<ServerScript> { static constexpr uint16 value = SERVERHOOK_END; };
+template<> struct ScriptHookCount<UnitScript> { static constexpr uint16 value = UNITHOOK_END; };
+template<> struct ScriptHookCount<AllCreatureScript> { static constexpr uint16 value = ALLCREATUREHOOK_END; };
+template<> struct ScriptHookCount<PlayerScript> { static constexpr uint16 value = PLAYERHOOK_END; };
+
 template<class TScript>
 class ScriptRegistry
 {
@@ -2775,13 +2829,27 @@ public:
     typedef std::vector<TScript*> ScriptVector;
     typedef typename ScriptVector::iterator ScriptVectorIterator;
 
+    typedef std::array<ScriptVector, ScriptHookCount<TScript>::value> EnabledHooksArray;
+
     // The actual list of scripts. This will be accessed concurrently, so it must not be modified
     // after server startup.
     static ScriptMap ScriptPointerList;
     // After database load scripts
     static ScriptVector ALScripts;
+    // Subscribers of each hook in registration order, same rules as ScriptPointerList
+    static EnabledHooksArray EnabledHooks;
 
+    // Subscribes the script to every hook of its type
     static void AddScript(TScript* const script)
+    {
+        std::vector<uint16> enabledHooks(ScriptHookCount<TScript>::value);
+        for (uint16 hook = 0; hook < enabledHooks.size(); ++hook)
+            enabledHooks[hook] = hook;
+
+        AddScript(script, std::move(enabledHooks));
+    }
+
+    static void AddScript(TScript* const script, std::vector<uint16> enabledHooks)
     {
         ASSERT(script);
 
@@ -2799,6 +2867,12 @@ public:
             // We're dealing with a code-only script; just add it.
             ScriptPointerList[_scriptIdCounter++] = script;
             sScriptMgr->IncrementScriptCount();
+
+            for (uint16 hook : enabledHooks)
+            {
+                ASSERT(hook < EnabledHooks.size(), "Script '{}' enables unknown hook {}", script->GetName(), hook);
+                EnabledHooks[hook].push_back(script);
+            }
         }
     }
 
@@ -2863,6 +2937,9 @@ public:
                 // We're dealing with a code-only script; just add it.
                 ScriptPointerList[_scriptIdCounter++] = script;
                 sScriptMgr->IncrementScriptCount();
+
+                for (ScriptVector& subscribers : EnabledHooks)
+                    subscribers.push_back(script);
             }
         }
     }
@@ -2905,6 +2982,7 @@ private:
 // Instantiate static members of ScriptRegistry.
 template<class TScript> std::map<uint32, TScript*> ScriptRegistry<TScript>::ScriptPointerList;
 template<class TScript> std::vector<TScript*> ScriptRegistry<TScript>::ALScripts;
+template<class TScript> typename ScriptRegistry<TScript>::EnabledHooksArray ScriptRegistry<TScript>::EnabledHooks;
 template<class TScript> uint32 ScriptRegistry<TScript>::_scriptIdCounter = 0;
 
 #endif
@@ -20,8 +20,8 @@
 
 #include "ScriptMgr.h"
 
-template<typename ScriptName>
-inline Optional<bool> IsValidBoolScript(std::function<bool(ScriptName*)> executeHook)
+template<typename ScriptName, typename TCallback>
+inline Optional<bool> IsValidBoolScript(TCallback&& executeHook)
 {
     if (ScriptRegistry<ScriptName>::ScriptPointerList.empty())
         return {};
@@ -35,8 +35,8 @@ inline Optional<bool> IsValidBoolScript(std::function<bool(ScriptName*)> execute
     return false;
 }
 
-template<typename ScriptName, class T>
-inline T* GetReturnAIScript(std::function<T*(ScriptName*)> executeHook)
+template<typename ScriptName, class T, typename TCallback>
+inline T* GetReturnAIScript(TCallback&& executeHook)
 {
     if (ScriptRegistry<ScriptName>::ScriptPointerList.empty())
         return nullptr;
@@ -52,8 +52,8 @@ inline T* GetReturnAIScript(std::function<T*(ScriptName*)> executeHook)
     return nullptr;
 }
 
-template<typename ScriptName>
-inline void ExecuteScript(std::function<void(ScriptName*)> executeHook)
+template<typename ScriptName, typename TCallback>
+inline void ExecuteScript(TCallback&& executeHook)
 {
     if (ScriptRegistry<ScriptName>::ScriptPointerList.empty())
         return;
@@ -64,6 +64,39 @@ inline void ExecuteScript(std::function<void(ScriptName*)> executeHook)
     }
 }
 
+// Same as IsValidBoolScript, but only for the scripts subscribed to hook
+template<typename ScriptName, typename TCallback>
+inline Optional<bool> IsValidBoolHook(uint16 hook, TCallback&& executeHook)
+{
+    auto const& subscribers = ScriptRegistry<ScriptName>::EnabledHooks[hook];
+    if (subscribers.empty())
+        return {};
+
+    for (ScriptName* script : subscribers)
+    {
+        if (executeHook(script))
+            return true;
+    }
+
+    return false;
+}
+
+// Same as ExecuteScript, but only for the scripts subscribed to hook
+template<typename ScriptName, typename TCallback>
+inline void ExecuteHook(uint16 hook, TCallback&& executeHook)
+{
+    for (ScriptName* script : ScriptRegistry<ScriptName>::EnabledHooks[hook])
+    {
+        executeHook(script);
+    }
+}
+
+template<typename ScriptName>
+inline bool HasHookSubscribers(uint16 hook)
+{
+    return !ScriptRegistry<ScriptName>::EnabledHooks[hook].empty();
+}
+
 inline bool ReturnValidBool(Optional<bool> ret, bool need = false)
 {
     return ret && *ret ? need : !need;
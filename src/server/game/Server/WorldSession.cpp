@@ -214,17 +214,33 @@ ObjectGuid::LowType WorldSession::GetGuidLow() const
 
 /// Send a packet to the client
 void WorldSession::SendPacket(WorldPacket const* packet)
+{
+    if (!CanSendPacket(packet))
+        return;
+
+    m_Socket->SendPacket(*packet);
+}
+
+void WorldSession::SendPacket(std::shared_ptr<WorldPacket const> const& packet)
+{
+    if (!CanSendPacket(packet.get()))
+        return;
+
+    m_Socket->SendPacket(packet);
+}
+
+bool WorldSession::CanSendPacket(WorldPacket const* packet)
 {
     if (packet->GetOpcode() == NULL_OPCODE)
     {
         LOG_ERROR("network.opcode", "{} send NULL_OPCODE", GetPlayerInfo());
-        return;
+        return false;
     }
 
     sScriptMgr->OnPlayerbotPacketSent(GetPlayer(), packet);
 
     if (!m_Socket)
-        return;
+        return false;
 
 #if defined(ACORE_DEBUG)
     // Code for network use statistic
@@ -264,11 +280,11 @@ void WorldSession::SendPacket(WorldPacket const* packet)
 
     if (!sScriptMgr->CanPacketSend(this, *packet))
     {
-        return;
+        return false;
     }
 
     LOG_TRACE("network.opcode", "S->C: {} {}", GetPlayerInfo(), GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())));
-    m_Socket->SendPacket(*packet);
+    return true;
 }
 
 /// Add an incoming packet to the queue
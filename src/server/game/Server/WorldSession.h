@@ -364,6 +364,8 @@ public:
     void WriteMovementInfo(WorldPacket* data, MovementInfo* mi);
 
     void SendPacket(WorldPacket const* packet);
+    /// Queues a packet shared by many receivers (broadcasts) to the socket without copying its payload
+    void SendPacket(std::shared_ptr<WorldPacket const> const& packet);
     void SendNotification(const char* format, ...) ATTR_PRINTF(2, 3);
     void SendNotification(uint32 string_id, ...);
     void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName* declinedName);
@@ -1161,6 +1163,9 @@ private:
     void LogUnexpectedOpcode(WorldPacket* packet, char const* status, const char* reason);
     void LogUnprocessedTail(WorldPacket* packet);
 
+    /// checks and hooks common to every outgoing packet, returns false if the packet must not be sent
+    bool CanSendPacket(WorldPacket const* packet);
+
     // EnumData helpers
     bool IsLegitCharacterForAccount(ObjectGuid guid)
     {
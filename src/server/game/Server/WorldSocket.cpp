@@ -28,14 +28,18 @@
 #include "Random.h"
 #include "Realm.h"
 #include "ScriptMgr.h"
+#include "Timer.h"
 #include "World.h"
 #include "WorldSession.h"
+#include "WorldSocketMgr.h"
+#include <algorithm>
 #include <memory>
 
 using boost::asio::ip::tcp;
 
 WorldSocket::WorldSocket(tcp::socket&& socket)
-    : Socket(std::move(socket)), _OverSpeedPings(0), _worldSession(nullptr), _authed(false), _sendBufferSize(4096)
+    : Socket(std::move(socket)), _OverSpeedPings(0), _worldSession(nullptr), _authed(false), _sendBufferSize(4096),
+    _sendBuffer(_sendBufferSize), _sendBufferFirstWriteTime(0), _writeLatencyBudget(0)
 {
     Acore::Crypto::GetRandomBytes(_authSeed);
     _headerBuffer.Resize(sizeof(ClientPktHeader));
@@ -81,50 +85,106 @@ void WorldSocket::CheckIpCallback(PreparedQueryResult result)
 
 bool WorldSocket::Update()
 {
+    // take every queued packet first, so that all headers go through ARC4 in a single call.
+    // The keystream only depends on how many bytes were encrypted before, not on where they are stored
     EncryptablePacket* queued;
-    MessageBuffer buffer(_sendBufferSize);
     while (_bufferQueue.Dequeue(queued))
     {
-        ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
+        WorldPacket const& packet = queued->GetPacket();
+        ServerPktHeader header(packet.size() + 2, packet.GetOpcode());
+        queued->HeaderLength = header.getHeaderLength();
+        std::copy_n(header.header, queued->HeaderLength, queued->Header.begin());
         if (queued->NeedsEncryption())
-            _authCrypt.EncryptSend(header.header, header.getHeaderLength());
+            _headerBatch.insert(_headerBatch.end(), queued->Header.begin(), queued->Header.begin() + queued->HeaderLength);
 
-        if (buffer.GetRemainingSpace() < queued->size() + header.getHeaderLength())
+        _sendBatch.push_back(queued);
+    }
+
+    if (!_headerBatch.empty())
+        _authCrypt.EncryptSend(_headerBatch.data(), _headerBatch.size());
+
+    std::size_t encryptedOffset = 0;
+    for (EncryptablePacket* batched : _sendBatch)
+    {
+        WorldPacket const& packet = batched->GetPacket();
+        if (batched->NeedsEncryption())
         {
-            QueuePacket(std::move(buffer));
-            buffer.Resize(_sendBufferSize);
+            std::copy_n(_headerBatch.begin() + encryptedOffset, batched->HeaderLength, batched->Header.begin());
+            encryptedOffset += batched->HeaderLength;
         }
 
-        if (buffer.GetRemainingSpace() >= queued->size() + header.getHeaderLength())
+        std::size_t packetSize = packet.size() + batched->HeaderLength;
+        if (_sendBuffer.GetRemainingSpace() < packetSize)
+            FlushSendBuffer();
+
+        if (_sendBuffer.GetRemainingSpace() >= packetSize)
         {
-            buffer.Write(header.header, header.getHeaderLength());
-            if (!queued->empty())
-                buffer.Write(queued->contents(), queued->size());
+            if (!_sendBuffer.GetActiveSize())
+                _sendBufferFirstWriteTime = getMSTime();
+
+            _sendBuffer.Write(batched->Header.data(), batched->HeaderLength);
+            if (!packet.empty())
+                _sendBuffer.Write(packet.contents(), packet.size());
         }
-        else    // single packet larger than 4096 bytes
+        else    // single packet larger than the send buffer
         {
-            MessageBuffer packetBuffer(queued->size() + header.getHeaderLength());
-            packetBuffer.Write(header.header, header.getHeaderLength());
-            if (!queued->empty())
-                packetBuffer.Write(queued->contents(), queued->size());
+            MessageBuffer packetBuffer(packetSize);
+            packetBuffer.Write(batched->Header.data(), batched->HeaderLength);
+            if (!packet.empty())
+                packetBuffer.Write(packet.contents(), packet.size());
 
             QueuePacket(std::move(packetBuffer));
         }
 
-        delete queued;
+        delete batched;
     }
 
-    if (buffer.GetActiveSize() > 0)
-        QueuePacket(std::move(buffer));
+    uint32 packetCount = uint32(_sendBatch.size());
+    _sendBatch.clear();
+    _headerBatch.clear();
+
+    // a partially filled buffer waits for the packets of the next iterations until the latency budget runs out,
+    // unless the socket is about to close
+    if (_sendBuffer.GetActiveSize() && (!IsOpen() || GetMSTimeDiffToNow(_sendBufferFirstWriteTime) >= _writeLatencyBudget))
+        FlushSendBuffer();
 
     if (!BaseSocket::Update())
         return false;
 
+    uint32 writeSyscalls;
+    std::size_t writtenBytes;
+    TakeWriteStatistics(writeSyscalls, writtenBytes);
+    if (packetCount || writeSyscalls)
+        sWorldSocketMgr.AddWriteStatistics(packetCount, writeSyscalls, writtenBytes);
+
     _queryProcessor.ProcessReadyCallbacks();
 
     return true;
 }
 
+bool WorldSocket::NeedsUpdate()
+{
+    // BaseSocket::NeedsUpdate consumes the flag set by SendPacket, keep it first
+    return BaseSocket::NeedsUpdate() || _sendBuffer.GetActiveSize() || !_queryProcessor.Empty();
+}
+
+void WorldSocket::FlushSendBuffer()
+{
+    if (!_sendBuffer.GetActiveSize())
+        return;
+
+    QueuePacket(std::move(_sendBuffer));
+    _sendBuffer.Resize(_sendBufferSize);
+}
+
+void WorldSocket::SetSendBufferSize(std::size_t sendBufferSize)
+{
+    _sendBufferSize = sendBufferSize;
+
+    if (_sendBuffer.GetBufferSize() < _sendBufferSize)
+        _sendBuffer.Resize(_sendBufferSize);
+}
+
 void WorldSocket::HandleSendAuthSession()
 {
     WorldPacket packet(SMSG_AUTH_CHALLENGE, 40);
@@ -416,14 +476,23 @@ void WorldSocket::SendPacketAndLogOpcode(WorldPacket const& packet)
 }
 
 void WorldSocket::SendPacket(WorldPacket const& packet)
+{
+    if (!IsOpen())
+        return;
+
+    SendPacket(std::make_shared<WorldPacket const>(packet));
+}
+
+void WorldSocket::SendPacket(std::shared_ptr<WorldPacket const> packet)
 {
     if (!IsOpen())
         return;
 
     if (sPacketLog->CanLogPacket())
-        sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
 
-    _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
+    _bufferQueue.Enqueue(new EncryptablePacket(std::move(packet), _authCrypt.IsInitialized()));
+    ScheduleUpdate();
 }
 
 void WorldSocket::HandleAuthSession(WorldPacket & recvPacket)
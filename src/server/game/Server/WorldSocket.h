@@ -30,19 +30,26 @@
 
 using boost::asio::ip::tcp;
 
-class EncryptablePacket : public WorldPacket
+/// Queued outgoing packet, the payload is immutable and may be shared with the queues of other sockets
+class EncryptablePacket
 {
 public:
-    EncryptablePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt)
+    EncryptablePacket(std::shared_ptr<WorldPacket const> packet, bool encrypt) : _packet(std::move(packet)), _encrypt(encrypt)
     {
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
+    WorldPacket const& GetPacket() const { return *_packet; }
     bool NeedsEncryption() const { return _encrypt; }
 
     std::atomic<EncryptablePacket*> SocketQueueLink;
 
+    // filled by the network thread when the packet is taken out of the socket queue
+    std::array<uint8, 5> Header;
+    uint8 HeaderLength = 0;
+
 private:
+    std::shared_ptr<WorldPacket const> _packet;
     bool _encrypt;
 };
 
@@ -77,10 +84,13 @@ public:
 
     void Start() override;
     bool Update() override;
+    bool NeedsUpdate() override;
 
     void SendPacket(WorldPacket const& packet);
+    void SendPacket(std::shared_ptr<WorldPacket const> packet);
 
-    void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
+    void SetSendBufferSize(std::size_t sendBufferSize);
+    void SetWriteLatencyBudget(uint32 milliseconds) { _writeLatencyBudget = milliseconds; }
 
 protected:
     void OnClose() override;
@@ -113,6 +123,9 @@ private:
 
     bool HandlePing(WorldPacket& recvPacket);
 
+    /// hands the packets coalesced so far over to the write queue
+    void FlushSendBuffer();
+
     std::array<uint8, 4> _authSeed;
     AuthCrypt _authCrypt;
 
@@ -126,7 +139,12 @@ private:
     MessageBuffer _headerBuffer;
     MessageBuffer _packetBuffer;
     MPSCQueue<EncryptablePacket, &EncryptablePacket::SocketQueueLink> _bufferQueue;
+    std::vector<EncryptablePacket*> _sendBatch;
+    std::vector<uint8> _headerBatch;
     std::size_t _sendBufferSize;
+    MessageBuffer _sendBuffer;
+    uint32 _sendBufferFirstWriteTime;
+    uint32 _writeLatencyBudget;
 
     QueryCallbackProcessor _queryProcessor;
     std::string _ipCountry;
@@ -28,6 +28,7 @@ public:
     void SocketAdded(std::shared_ptr<WorldSocket> sock) override
     {
         sock->SetSendBufferSize(sWorldSocketMgr.GetApplicationSendBufferSize());
+        sock->SetWriteLatencyBudget(sWorldSocketMgr.GetWriteLatencyBudget());
         sScriptMgr->OnSocketOpen(sock);
     }
 
@@ -38,7 +39,8 @@ public:
 };
 
 WorldSocketMgr::WorldSocketMgr() :
-    BaseSocketMgr(), _socketSystemSendBufferSize(-1), _socketApplicationSendBufferSize(65536), _tcpNoDelay(true)
+    BaseSocketMgr(), _socketSystemSendBufferSize(-1), _socketApplicationSendBufferSize(65536), _writeLatencyBudget(0), _tcpNoDelay(true),
+    _writtenPackets(0), _writeSyscalls(0), _writtenBytes(0)
 {
 }
 
@@ -65,10 +67,15 @@ bool WorldSocketMgr::StartWorldNetwork(Acore::Asio::IoContext& ioContext, std::s
         return false;
     }
 
+    _writeLatencyBudget = sConfigMgr->GetOption<uint32>("Network.WriteLatencyBudget", 0);
+    _reusePort = sConfigMgr->GetOption<bool>("Network.ReusePort", false);
+    _eventDrivenUpdates = sConfigMgr->GetOption<bool>("Network.EventDrivenUpdates", false);
+    _threadAffinity = sConfigMgr->GetOption<uint32>("Network.ThreadAffinity", 0);
+
     if (!BaseSocketMgr::StartNetwork(ioContext, bindIp, port, threadCount))
         return false;
 
-    _acceptor->AsyncAcceptWithCallback<&WorldSocketMgr::OnSocketAccept>();
+    StartAccepting<&WorldSocketMgr::OnSocketAccept>();
 
     sScriptMgr->OnNetworkStart();
     return true;
@@ -112,6 +119,20 @@ void WorldSocketMgr::OnSocketOpen(tcp::socket&& sock, uint32 threadIndex)
     BaseSocketMgr::OnSocketOpen(std::forward<tcp::socket>(sock), threadIndex);
 }
 
+void WorldSocketMgr::AddWriteStatistics(uint32 packets, uint32 syscalls, std::size_t bytes)
+{
+    _writtenPackets.fetch_add(packets, std::memory_order_relaxed);
+    _writeSyscalls.fetch_add(syscalls, std::memory_order_relaxed);
+    _writtenBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void WorldSocketMgr::TakeWriteStatistics(uint64& packets, uint64& syscalls, uint64& bytes)
+{
+    packets = _writtenPackets.exchange(0, std::memory_order_relaxed);
+    syscalls = _writeSyscalls.exchange(0, std::memory_order_relaxed);
+    bytes = _writtenBytes.exchange(0, std::memory_order_relaxed);
+}
+
 NetworkThread<WorldSocket>* WorldSocketMgr::CreateThreads() const
 {
     return new WorldSocketThread[GetNetworkThreadCount()];
@@ -24,6 +24,7 @@
 #define __WORLDSOCKETMGR_H
 
 #include "SocketMgr.h"
+#include <atomic>
 
 class WorldSocket;
 
@@ -44,6 +45,13 @@ public:
     void OnSocketOpen(tcp::socket&& sock, uint32 threadIndex) override;
 
     std::size_t GetApplicationSendBufferSize() const { return _socketApplicationSendBufferSize; }
+    uint32 GetWriteLatencyBudget() const { return _writeLatencyBudget; }
+
+    /// Accumulates what a socket sent during one network thread iteration
+    void AddWriteStatistics(uint32 packets, uint32 syscalls, std::size_t bytes);
+
+    /// Returns the packets, write syscalls and bytes sent by all sockets since the previous call
+    void TakeWriteStatistics(uint64& packets, uint64& syscalls, uint64& bytes);
 
 protected:
     WorldSocketMgr();
@@ -58,7 +66,12 @@ protected:
 private:
     int32 _socketSystemSendBufferSize;
     int32 _socketApplicationSendBufferSize;
+    uint32 _writeLatencyBudget;
     bool _tcpNoDelay;
+
+    std::atomic<uint64> _writtenPackets;
+    std::atomic<uint64> _writeSyscalls;
+    std::atomic<uint64> _writtenBytes;
 };
 
 #define sWorldSocketMgr WorldSocketMgr::Instance()
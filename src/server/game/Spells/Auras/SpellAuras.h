@@ -18,6 +18,7 @@
 #ifndef ACORE_SPELLAURAS_H
 #define ACORE_SPELLAURAS_H
 
+#include "ObjectPool.h"
 #include "SpellAuraDefines.h"
 #include "Unit.h"
 
@@ -58,6 +59,8 @@ private:
     void _InitFlags(Unit* caster, uint8 effMask);
     void _HandleEffect(uint8 effIndex, bool apply);
 public:
+    ACORE_POOLED_ALLOCATION(AuraApplication)
+
     Unit* GetTarget() const { return _target; }
     Aura* GetBase() const { return _base; }
 
@@ -34,6 +34,7 @@
 #include "Log.h"
 #include "LootMgr.h"
 #include "MapMgr.h"
+#include "Metric.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
@@ -519,6 +520,8 @@ class SpellEvent : public BasicEvent
         SpellEvent(Spell* spell);
         ~SpellEvent();
 
+        ACORE_POOLED_ALLOCATION(SpellEvent)
+
         bool Execute(uint64 e_time, uint32 p_time);
         void Abort(uint64 e_time);
         bool IsDeletable() const;
@@ -1326,6 +1329,8 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
             return;
     }
 
+    METRIC_DETAILED_TIMER("spell_area_target_selection_time", METRIC_TAG("spell_id", std::to_string(m_spellInfo->Id)));
+
     // Xinef: the distance should be increased by caster size, it is neglected in latter calculations
     std::list<WorldObject*> targets;
     float radius = m_spellInfo->Effects[effIndex].CalcRadius(m_caster) * m_spellValue->RadiusMod;
@@ -2403,8 +2408,10 @@ void Spell::CleanupTargetList()
 
 void Spell::AddUnitTarget(Unit* target, uint32 effectMask, bool checkIfValid /*= true*/, bool implicit /*= true*/)
 {
+    // line of sight towards the target is the same for every effect, only trace it once
+    Optional<bool> losResult;
     for (uint32 effIndex = 0; effIndex < MAX_SPELL_EFFECTS; ++effIndex)
-        if (!m_spellInfo->Effects[effIndex].IsEffect() || !CheckEffectTarget(target, effIndex))
+        if (!m_spellInfo->Effects[effIndex].IsEffect() || !CheckEffectTarget(target, effIndex, &losResult))
             effectMask &= ~(1 << effIndex);
 
     // no effects left
@@ -8048,7 +8055,7 @@ CurrentSpellTypes Spell::GetCurrentContainer() const
         return(CURRENT_GENERIC_SPELL);
 }
 
-bool Spell::CheckEffectTarget(Unit const* target, uint32 eff) const
+bool Spell::CheckEffectTarget(Unit const* target, uint32 eff, Optional<bool>* losResult /*= nullptr*/) const
 {
     switch (m_spellInfo->Effects[eff].ApplyAuraName)
     {
@@ -8140,50 +8147,63 @@ bool Spell::CheckEffectTarget(Unit const* target, uint32 eff) const
             break;
         default: // normal case
         {
-            uint32 losChecks = LINEOFSIGHT_ALL_CHECKS;
-            GameObject* gobCaster = nullptr;
-            if (m_originalCasterGUID.IsGameObject())
-            {
-                gobCaster = m_caster->GetMap()->GetGameObject(m_originalCasterGUID);
-            }
-            else if (m_caster->GetEntry() == WORLD_TRIGGER)
-            {
-                if (TempSummon* tempSummon = m_caster->ToTempSummon())
-                {
-                    gobCaster = tempSummon->GetSummonerGameObject();
-                }
-            }
+            if (losResult && losResult->has_value())
+                return **losResult;
 
-            if (gobCaster)
-            {
-                if (gobCaster->GetGOInfo()->IsIgnoringLOSChecks())
-                {
-                    return true;
-                }
+            bool const inLOS = CheckEffectTargetLOS(target);
+            if (losResult)
+                *losResult = inLOS;
 
-                // If spell casted by gameobject then ignore M2 models
-                losChecks &= ~LINEOFSIGHT_CHECK_GOBJECT_M2;
-            }
+            return inLOS;
+        }
+    }
 
-            if (target != m_caster)
-            {
-                if (m_targets.HasDst())
-                {
-                    float x = m_targets.GetDstPos()->GetPositionX();
-                    float y = m_targets.GetDstPos()->GetPositionY();
-                    float z = m_targets.GetDstPos()->GetPositionZ();
+    return true;
+}
 
-                    if (!target->IsWithinLOS(x, y, z, VMAP::ModelIgnoreFlags::M2, LineOfSightChecks(losChecks)))
-                    {
-                        return false;
-                    }
-                }
-                else if (!m_caster->IsWithinLOSInMap(target, VMAP::ModelIgnoreFlags::M2, LineOfSightChecks(losChecks)))
-                {
-                    return false;
-                }
+bool Spell::CheckEffectTargetLOS(Unit const* target) const
+{
+    uint32 losChecks = LINEOFSIGHT_ALL_CHECKS;
+    GameObject* gobCaster = nullptr;
+    if (m_originalCasterGUID.IsGameObject())
+    {
+        gobCaster = m_caster->GetMap()->GetGameObject(m_originalCasterGUID);
+    }
+    else if (m_caster->GetEntry() == WORLD_TRIGGER)
+    {
+        if (TempSummon* tempSummon = m_caster->ToTempSummon())
+        {
+            gobCaster = tempSummon->GetSummonerGameObject();
+        }
+    }
+
+    if (gobCaster)
+    {
+        if (gobCaster->GetGOInfo()->IsIgnoringLOSChecks())
+        {
+            return true;
+        }
+
+        // If spell casted by gameobject then ignore M2 models
+        losChecks &= ~LINEOFSIGHT_CHECK_GOBJECT_M2;
+    }
+
+    if (target != m_caster)
+    {
+        if (m_targets.HasDst())
+        {
+            float x = m_targets.GetDstPos()->GetPositionX();
+            float y = m_targets.GetDstPos()->GetPositionY();
+            float z = m_targets.GetDstPos()->GetPositionZ();
+
+            if (!target->IsWithinLOS(x, y, z, VMAP::ModelIgnoreFlags::M2, LineOfSightChecks(losChecks)))
+            {
+                return false;
             }
-            break;
+        }
+        else if (!m_caster->IsWithinLOSInMap(target, VMAP::ModelIgnoreFlags::M2, LineOfSightChecks(losChecks)))
+        {
+            return false;
         }
     }
 
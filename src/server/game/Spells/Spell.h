@@ -20,6 +20,7 @@
 
 #include "GridDefines.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "PathGenerator.h"
 #include "SharedDefines.h"
 #include "SpellInfo.h"
@@ -288,6 +289,8 @@ public:
     Spell(Unit* caster, SpellInfo const* info, TriggerCastFlags triggerFlags, ObjectGuid originalCasterGUID = ObjectGuid::Empty, bool skipCheck = false);
     ~Spell();
 
+    ACORE_POOLED_ALLOCATION(Spell)
+
     void EffectNULL(SpellEffIndex effIndex);
     void EffectUnused(SpellEffIndex effIndex);
     void EffectDistract(SpellEffIndex effIndex);
@@ -486,7 +489,8 @@ public:
     void WriteSpellGoTargets(WorldPacket* data);
     void WriteAmmoToPacket(WorldPacket* data);
 
-    bool CheckEffectTarget(Unit const* target, uint32 eff) const;
+    bool CheckEffectTarget(Unit const* target, uint32 eff, Optional<bool>* losResult = nullptr) const;
+    bool CheckEffectTargetLOS(Unit const* target) const;
     bool CanAutoCast(Unit* target);
     void CheckSrc() { if (!m_targets.HasSrc()) m_targets.SetSrc(*m_caster); }
     void CheckDst() { if (!m_targets.HasDst()) m_targets.SetDst(*m_caster); }
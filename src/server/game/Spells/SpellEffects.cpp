@@ -4991,8 +4991,11 @@ void Spell::EffectForceDeselect(SpellEffIndex /*effIndex*/)
     data << m_caster->GetGUID();
 
     float dist = m_caster->GetVisibilityRange() + VISIBILITY_COMPENSATION;
-    Acore::MessageDistDelivererToHostile notifier(m_caster, &data, dist);
-    Cell::VisitWorldObjects(m_caster, notifier, dist);
+    {
+        // the packet is sent to a single receiver when the notifier goes out of scope
+        Acore::MessageDistDelivererToHostile notifier(m_caster, &data, dist);
+        Cell::VisitWorldObjects(m_caster, notifier, dist);
+    }
 
     // xinef: we should also force pets to remove us from current target
     Unit::AttackerSet attackerSet;
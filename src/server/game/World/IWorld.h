@@ -144,6 +144,7 @@ enum WorldBoolConfigs
     CONFIG_ENABLE_MMAPS, // pussywizard
     CONFIG_ENABLE_LOGIN_AFTER_DC, // pussywizard
     CONFIG_DONT_CACHE_RANDOM_MOVEMENT_PATHS, // pussywizard
+    CONFIG_FORMATION_SHARED_PATH,
     CONFIG_QUEST_IGNORE_AUTO_ACCEPT,
     CONFIG_QUEST_IGNORE_AUTO_COMPLETE,
     CONFIG_QUEST_ENABLE_QUEST_TRACKER,
@@ -228,6 +229,7 @@ enum WorldIntConfigs
     CONFIG_CHARACTERS_PER_ACCOUNT,
     CONFIG_CHARACTERS_PER_REALM,
     CONFIG_CREATURE_STOP_FOR_PLAYER,
+    CONFIG_CREATURE_IDLE_UPDATE_INTERVAL,
     CONFIG_HEROIC_CHARACTERS_PER_REALM,
     CONFIG_CHARACTER_CREATING_MIN_LEVEL_FOR_HEROIC_CHARACTER,
     CONFIG_SKIP_CINEMATICS,
@@ -258,6 +260,7 @@ enum WorldIntConfigs
     CONFIG_GM_LEVEL_IN_WHO_LIST,
     CONFIG_START_GM_LEVEL,
     CONFIG_GROUP_VISIBILITY,
+    CONFIG_VISIBILITY_CACHE_DURATION,
     CONFIG_MAIL_DELIVERY_DELAY,
     CONFIG_UPTIME_UPDATE,
     CONFIG_SKILL_CHANCE_ORANGE,
@@ -412,6 +415,8 @@ enum WorldIntConfigs
     CONFIG_LFG_KICK_PREVENTION_TIMER,
     CONFIG_CHANGE_FACTION_MAX_MONEY,
     CONFIG_WATER_BREATH_TIMER,
+    CONFIG_CHARACTER_CACHE_LOAD_THREADS,
+    CONFIG_GRID_UNLOAD_IDLE_TIME,
     INT_CONFIG_VALUE_COUNT
 };
 
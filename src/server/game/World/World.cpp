@@ -68,6 +68,7 @@
 #include "Opcodes.h"
 #include "OutdoorPvPMgr.h"
 #include "QueryHolder.h"
+#include "QuerySnapshot.h"
 #include "PetitionMgr.h"
 #include "Player.h"
 #include "PlayerDump.h"
@@ -938,6 +939,7 @@ void World::LoadConfigSettings(bool reload)
     _float_configs[CONFIG_CHANCE_OF_GM_SURVEY] = sConfigMgr->GetOption<float>("GM.TicketSystem.ChanceOfGMSurvey", 50.0f);
 
     _int_configs[CONFIG_GROUP_VISIBILITY]      = sConfigMgr->GetOption<int32>("Visibility.GroupMode", 1);
+    _int_configs[CONFIG_VISIBILITY_CACHE_DURATION] = sConfigMgr->GetOption<uint32>("Visibility.CacheDuration", 0);
 
     _bool_configs[CONFIG_OBJECT_SPARKLES]      = sConfigMgr->GetOption<bool>("Visibility.ObjectSparkles", true);
 
@@ -981,6 +983,7 @@ void World::LoadConfigSettings(bool reload)
     _int_configs[CONFIG_MAX_ALLOWED_MMR_DROP]              = sConfigMgr->GetOption<int32>("MaxAllowedMMRDrop", 500); // pussywizard
     _bool_configs[CONFIG_ENABLE_LOGIN_AFTER_DC]            = sConfigMgr->GetOption<bool>("EnableLoginAfterDC", true); // pussywizard
     _bool_configs[CONFIG_DONT_CACHE_RANDOM_MOVEMENT_PATHS] = sConfigMgr->GetOption<bool>("DontCacheRandomMovementPaths", true); // pussywizard
+    _bool_configs[CONFIG_FORMATION_SHARED_PATH] = sConfigMgr->GetOption<bool>("FormationSharedPath", false);
 
     _int_configs[CONFIG_SKILL_CHANCE_ORANGE] = sConfigMgr->GetOption<int32>("SkillChance.Orange", 100);
     _int_configs[CONFIG_SKILL_CHANCE_YELLOW] = sConfigMgr->GetOption<int32>("SkillChance.Yellow", 75);
@@ -1189,6 +1192,7 @@ void World::LoadConfigSettings(bool reload)
 
     _bool_configs[CONFIG_OFFHAND_CHECK_AT_SPELL_UNLEARN]            = sConfigMgr->GetOption<bool>("OffhandCheckAtSpellUnlearn", true);
     _int_configs[CONFIG_CREATURE_STOP_FOR_PLAYER]                   = sConfigMgr->GetOption<uint32>("Creature.MovingStopTimeForPlayer", 3 * MINUTE * IN_MILLISECONDS);
+    _int_configs[CONFIG_CREATURE_IDLE_UPDATE_INTERVAL]              = sConfigMgr->GetOption<uint32>("Creature.IdleUpdateInterval", 0);
 
     _int_configs[CONFIG_WATER_BREATH_TIMER]                       = sConfigMgr->GetOption<uint32>("WaterBreath.Timer", 180000);
     if (_int_configs[CONFIG_WATER_BREATH_TIMER] <= 0)
@@ -1342,6 +1346,7 @@ void World::LoadConfigSettings(bool reload)
     _bool_configs[CONFIG_SHOW_MUTE_IN_WORLD]         = sConfigMgr->GetOption<bool>("ShowMuteInWorld", false);
     _bool_configs[CONFIG_SHOW_BAN_IN_WORLD]          = sConfigMgr->GetOption<bool>("ShowBanInWorld", false);
     _int_configs[CONFIG_NUMTHREADS]                  = sConfigMgr->GetOption<int32>("MapUpdate.Threads", 1);
+    _int_configs[CONFIG_CHARACTER_CACHE_LOAD_THREADS] = sConfigMgr->GetOption<int32>("CharacterCache.LoadThreads", 2);
     _int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = sConfigMgr->GetOption<int32>("Command.LookupMaxResults", 0);
 
     // Warden
@@ -1412,6 +1417,14 @@ void World::LoadConfigSettings(bool reload)
     // Preload all grids of all non-instanced maps
     _bool_configs[CONFIG_PRELOAD_ALL_NON_INSTANCED_MAP_GRIDS] = sConfigMgr->GetOption<bool>("PreloadAllNonInstancedMapGrids", false);
 
+    // Unload grids of non-instanced maps that nothing used for a while
+    _int_configs[CONFIG_GRID_UNLOAD_IDLE_TIME] = sConfigMgr->GetOption<int32>("GridUnloadIdleTime", 0);
+    if (_int_configs[CONFIG_GRID_UNLOAD_IDLE_TIME] && _bool_configs[CONFIG_PRELOAD_ALL_NON_INSTANCED_MAP_GRIDS])
+    {
+        LOG_ERROR("server.loading", "GridUnloadIdleTime ({}) can't be used with PreloadAllNonInstancedMapGrids, set to 0.", _int_configs[CONFIG_GRID_UNLOAD_IDLE_TIME]);
+        _int_configs[CONFIG_GRID_UNLOAD_IDLE_TIME] = 0;
+    }
+
     // ICC buff override
     _int_configs[CONFIG_ICC_BUFF_HORDE] = sConfigMgr->GetOption<int32>("ICC.Buff.Horde", 73822);
     _int_configs[CONFIG_ICC_BUFF_ALLIANCE] = sConfigMgr->GetOption<int32>("ICC.Buff.Alliance", 73828);
@@ -1549,6 +1562,9 @@ void World::SetInitialWorldSettings()
     ///- Custom Hook for loading DB items
     sScriptMgr->OnLoadCustomDatabaseTable();
 
+    ///- Static tables below are read through the snapshot until it is saved after the loot tables
+    sQuerySnapshot->Open(sConfigMgr->GetOption<std::string>("StaticDataSnapshotFile", ""));
+
     ///- Load the DBC files
     LOG_INFO("server.loading", "Initialize Data Stores...");
     LoadDBCStores(_dataPath);
@@ -1873,6 +1889,8 @@ void World::SetInitialWorldSettings()
     // Loot tables
     LoadLootTables();
 
+    sQuerySnapshot->Save();
+
     LOG_INFO("server.loading", "Loading Skill Discovery Table...");
     LoadSkillDiscoveryTable();
 
@@ -1941,6 +1959,7 @@ void World::SetInitialWorldSettings()
 
     LOG_INFO("server.loading", "Loading Waypoints...");
     sWaypointMgr->Load();
+    sWaypointMgr->LoadBakedPaths(sConfigMgr->GetOption<std::string>("WaypointBakedPathsFile", ""));
 
     LOG_INFO("server.loading", "Loading SmartAI Waypoints...");
     sSmartWaypointMgr->LoadFromDB();
@@ -2265,7 +2284,7 @@ void World::LoadMotd()
 /// Update the World !
 void World::Update(uint32 diff)
 {
-    METRIC_TIMER("world_update_time_total");
+    METRIC_HISTOGRAM_TIMER("world_update_time_total");
 
     ///- Update the game time and check for shutdown time
     _UpdateGameTime();
@@ -2300,13 +2319,13 @@ void World::Update(uint32 diff)
     ///- Update Who List Cache
     if (_timers[WUPDATE_WHO_LIST].Passed())
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update who list"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Update who list"));
         _timers[WUPDATE_WHO_LIST].Reset();
         sWhoListCacheMgr->Update();
     }
 
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Check quest reset times"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Check quest reset times"));
 
         /// Handle daily quests reset time
         if (currentGameTime > _nextDailyQuestReset)
@@ -2329,19 +2348,19 @@ void World::Update(uint32 diff)
 
     if (currentGameTime > _nextRandomBGReset)
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Reset random BG"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Reset random BG"));
         ResetRandomBG();
     }
 
     if (currentGameTime > _nextCalendarOldEventsDeletionTime)
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Delete old calendar events"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Delete old calendar events"));
         CalendarDeleteOldEvents();
     }
 
     if (currentGameTime > _nextGuildReset)
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Reset guild cap"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Reset guild cap"));
         ResetGuildCap();
     }
 
@@ -2357,7 +2376,7 @@ void World::Update(uint32 diff)
         // pussywizard: handle auctions when the timer has passed
         if (_timers[WUPDATE_AUCTIONS].Passed())
         {
-            METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update expired auctions"));
+            METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Update expired auctions"));
 
             _timers[WUPDATE_AUCTIONS].Reset();
 
@@ -2375,7 +2394,7 @@ void World::Update(uint32 diff)
 
         {
             /// <li> Handle session updates when the timer has passed
-            METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update sessions"));
+            METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Update sessions"));
             UpdateSessions(diff);
         }
     }
@@ -2395,7 +2414,7 @@ void World::Update(uint32 diff)
     {
         if (_timers[WUPDATE_CLEANDB].Passed())
         {
-            METRIC_TIMER("world_update_time", METRIC_TAG("type", "Clean logs table"));
+            METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Clean logs table"));
 
             _timers[WUPDATE_CLEANDB].Reset();
 
@@ -2407,13 +2426,13 @@ void World::Update(uint32 diff)
     }
 
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update LFG 0"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Update LFG 0"));
         sLFGMgr->Update(diff, 0); // pussywizard: remove obsolete stuff before finding compatibility during map update
     }
 
     {
         ///- Update objects when the timer has passed (maps, transport, creatures, ...)
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update maps"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Update maps"));
         sMapMgr->Update(diff);
     }
 
@@ -2421,34 +2440,34 @@ void World::Update(uint32 diff)
     {
         if (_timers[WUPDATE_AUTOBROADCAST].Passed())
         {
-            METRIC_TIMER("world_update_time", METRIC_TAG("type", "Send autobroadcast"));
+            METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Send autobroadcast"));
             _timers[WUPDATE_AUTOBROADCAST].Reset();
             sAutobroadcastMgr->SendAutobroadcasts();
         }
     }
 
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update battlegrounds"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Update battlegrounds"));
         sBattlegroundMgr->Update(diff);
     }
 
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update outdoor pvp"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Update outdoor pvp"));
         sOutdoorPvPMgr->Update(diff);
     }
 
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update battlefields"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Update battlefields"));
         sBattlefieldMgr->Update(diff);
     }
 
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update LFG 2"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Update LFG 2"));
         sLFGMgr->Update(diff, 2); // pussywizard: handle created proposals
     }
 
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Process query callbacks"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Process query callbacks"));
         // execute callbacks from sql queries that were queued recently
         ProcessQueryCallbacks();
     }
@@ -2456,7 +2475,7 @@ void World::Update(uint32 diff)
     /// <li> Update uptime table
     if (_timers[WUPDATE_UPTIME].Passed())
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update uptime"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Update uptime"));
 
         _timers[WUPDATE_UPTIME].Reset();
 
@@ -2471,7 +2490,7 @@ void World::Update(uint32 diff)
     ///- Erase corpses once every 20 minutes
     if (_timers[WUPDATE_CORPSES].Passed())
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Remove old corpses"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Remove old corpses"));
         _timers[WUPDATE_CORPSES].Reset();
 
         sMapMgr->DoForAllMaps([](Map* map)
@@ -2483,7 +2502,7 @@ void World::Update(uint32 diff)
     ///- Process Game events when necessary
     if (_timers[WUPDATE_EVENTS].Passed())
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update game events"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Update game events"));
         _timers[WUPDATE_EVENTS].Reset();                   // to give time for Update() to be processed
         uint32 nextGameEvent = sGameEventMgr->Update();
         _timers[WUPDATE_EVENTS].SetInterval(nextGameEvent);
@@ -2493,7 +2512,7 @@ void World::Update(uint32 diff)
     ///- Ping to keep MySQL connections alive
     if (_timers[WUPDATE_PINGDB].Passed())
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Ping MySQL"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Ping MySQL"));
         _timers[WUPDATE_PINGDB].Reset();
         LOG_DEBUG("sql.driver", "Ping MySQL to keep connection alive");
         CharacterDatabase.KeepAlive();
@@ -2503,29 +2522,29 @@ void World::Update(uint32 diff)
     }
 
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update instance reset times"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Update instance reset times"));
         // update the instance reset times
         sInstanceSaveMgr->Update();
     }
 
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Process cli commands"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Process cli commands"));
         // And last, but not least handle the issued cli commands
         ProcessCliCommands();
     }
 
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update world scripts"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Update world scripts"));
         sScriptMgr->OnWorldUpdate(diff);
     }
 
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update playersSaveScheduler"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Update playersSaveScheduler"));
         playersSaveScheduler.Update(diff);
     }
 
     {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update metrics"));
+        METRIC_HISTOGRAM_TIMER("world_update_time", METRIC_TAG("type", "Update metrics"));
         // Stats logger update
         sMetric->Update();
         METRIC_VALUE("update_time_diff", diff);
@@ -22,14 +22,18 @@
  Category: commandscripts
  EndScriptData */
 
+#include "AchievementMgr.h"
 #include "Bag.h"
 #include "BattlegroundMgr.h"
 #include "CellImpl.h"
 #include "Channel.h"
 #include "Chat.h"
+#include "Containers.h"
+#include "GameTime.h"
 #include "GossipDef.h"
 #include "GridNotifiersImpl.h"
 #include "InstanceScript.h"
+#include "LFGQueue.h"
 #include "Language.h"
 #include "Log.h"
 #include "MapMgr.h"
@@ -41,6 +45,8 @@
 #include "Transport.h"
 #include "Warden.h"
 #include "World.h"
+#include "WorldSocket.h"
+#include <chrono>
 #include <fstream>
 #include <set>
 
@@ -105,6 +111,9 @@ public:
             { "moveflags",      HandleDebugMoveflagsCommand,           SEC_ADMINISTRATOR, Console::No },
             { "unitstate",      HandleDebugUnitStateCommand,           SEC_ADMINISTRATOR, Console::No },
             { "objectcount",    HandleDebugObjectCountCommand,         SEC_ADMINISTRATOR, Console::Yes},
+            { "achievementbench", HandleDebugAchievementBenchCommand,  SEC_ADMINISTRATOR, Console::No },
+            { "lfgbench",       HandleDebugLfgBenchCommand,            SEC_ADMINISTRATOR, Console::Yes},
+            { "broadcastbench", HandleDebugBroadcastBenchCommand,      SEC_ADMINISTRATOR, Console::Yes},
             { "dummy",          HandleDebugDummyCommand,               SEC_ADMINISTRATOR, Console::No }
         };
         static ChatCommandTable commandTable =
@@ -1346,6 +1355,146 @@ public:
             handler->PSendSysMessage("Entry: %u Count: %u", p.first, p.second);
     }
 
+    // Times the achievement criteria lookup of creature kills for the selected player, once through the
+    // (type, creature entry) index with completed achievements skipped and once scanning every kill criteria
+    static bool HandleDebugAchievementBenchCommand(ChatHandler* handler, uint32 creatureEntry, Optional<uint32> iterations)
+    {
+        Player* player = handler->getSelectedPlayerOrSelf();
+        if (!player)
+        {
+            handler->SendSysMessage(LANG_NO_CHAR_SELECTED);
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        uint32 count = std::max<uint32>(iterations.value_or(10000), 1);
+        AchievementMgr* achievementMgr = player->GetAchievementMgr();
+
+        handler->PSendSysMessage("Achievement criteria dispatch of %u kills of creature %u for %s:", count, creatureEntry, player->GetName().c_str());
+        for (bool useIndex : { true, false })
+        {
+            CriteriaDispatchStats stats;
+            auto start = std::chrono::steady_clock::now();
+            for (uint32 i = 0; i < count; ++i)
+                stats = achievementMgr->DryRunCriteriaDispatch(ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE, creatureEntry, 1, useIndex);
+
+            uint64 elapsed = uint64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+            handler->PSendSysMessage("    %s: %u ns per kill, %u criteria visited, %u skipped as completed, %u updatable", useIndex ? "indexed" : "full scan",
+                uint32(elapsed / count), stats.Visited, stats.Skipped, stats.Updatable);
+        }
+
+        return true;
+    }
+
+    static bool HandleDebugLfgBenchCommand(ChatHandler* handler, Optional<uint32> playerCount)
+    {
+        // fake players, far above the guids of real characters; they are never online so no proposal is created for them
+        constexpr ObjectGuid::LowType FirstBenchGuid = 0xF0000000;
+        constexpr std::array<uint32, 8> SpecificDungeons = { 205, 206, 207, 208, 209, 210, 211, 212 };
+        constexpr uint32 RandomHeroicDungeon = 262;
+
+        uint32 count = std::clamp<uint32>(playerCount.value_or(2000), 5, 100000);
+
+        // same queue for both runs: 10% tanks, 12% healers, 16% hybrids, the rest damage dealers;
+        // 70% queue for the random heroic, the others for one to three specific dungeons
+        std::vector<std::pair<uint8, lfg::LfgDungeonSet>> players(count);
+        for (std::pair<uint8, lfg::LfgDungeonSet>& player : players)
+        {
+            uint32 roll = urand(0, 99);
+            if (roll < 10)
+                player.first = lfg::PLAYER_ROLE_TANK;
+            else if (roll < 22)
+                player.first = lfg::PLAYER_ROLE_HEALER;
+            else if (roll < 30)
+                player.first = lfg::PLAYER_ROLE_TANK | lfg::PLAYER_ROLE_DAMAGE;
+            else if (roll < 38)
+                player.first = lfg::PLAYER_ROLE_HEALER | lfg::PLAYER_ROLE_DAMAGE;
+            else
+                player.first = lfg::PLAYER_ROLE_DAMAGE;
+
+            player.first |= lfg::PLAYER_ROLE_LEADER;
+
+            if (urand(0, 99) < 70)
+                player.second.insert(RandomHeroicDungeon);
+            else
+                for (uint32 i = urand(1, 3); i; --i)
+                    player.second.insert(Acore::Containers::SelectRandomContainerElement(SpecificDungeons));
+        }
+
+        handler->PSendSysMessage("LFG matching of %u queued players:", count);
+        for (bool skipByMask : { true, false })
+        {
+            lfg::LFGQueue queue;
+            queue.EnableDryRun(skipByMask);
+
+            time_t now = GameTime::GetGameTime().count();
+            for (uint32 i = 0; i < count; ++i)
+            {
+                ObjectGuid guid = ObjectGuid::Create<HighGuid::Player>(FirstBenchGuid + i);
+                queue.AddQueueData(guid, now, players[i].second, { { guid, players[i].first } });
+            }
+
+            uint64 longest = 0;
+            auto start = std::chrono::steady_clock::now();
+            while (true)
+            {
+                auto updateStart = std::chrono::steady_clock::now();
+                if (!queue.FindGroups())
+                    break;
+
+                longest = std::max<uint64>(longest, uint64(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - updateStart).count()));
+            }
+
+            uint64 elapsed = uint64(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+            lfg::LfgMatchStats const& stats = queue.GetMatchStats();
+            handler->PSendSysMessage("    %s: %u ms, longest update %u us, %u groups, %u of %u partial groups rejected by masks",
+                skipByMask ? "masks" : "full checks", uint32(elapsed), uint32(longest), stats.matched, uint32(stats.skipped), uint32(stats.checked));
+        }
+
+        return true;
+    }
+
+    static bool HandleDebugBroadcastBenchCommand(ChatHandler* handler, Optional<uint32> receiverCount, Optional<uint32> packetSize, Optional<uint32> iterations)
+    {
+        uint32 receivers = std::clamp<uint32>(receiverCount.value_or(500), 1, 10000);
+        uint32 size = std::clamp<uint32>(packetSize.value_or(64), 1, 65535);
+        uint32 count = std::clamp<uint32>(iterations.value_or(1000), 1, 100000);
+
+        WorldPacket packet(SMSG_MONSTER_MOVE, size);
+        packet.resize(size);
+
+        // what the socket queues of the receivers hold after one broadcast, the network write is left out
+        std::vector<EncryptablePacket*> queued;
+        queued.reserve(receivers);
+
+        handler->PSendSysMessage("Broadcast of a %u byte packet to %u receivers, %u times:", size, receivers, count);
+        for (bool shared : { true, false })
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (uint32 i = 0; i < count; ++i)
+            {
+                std::shared_ptr<WorldPacket const> payload;
+                for (uint32 receiver = 0; receiver < receivers; ++receiver)
+                {
+                    if (!shared || !payload)
+                        payload = std::make_shared<WorldPacket const>(packet);
+
+                    queued.push_back(new EncryptablePacket(payload, true));
+                }
+
+                for (EncryptablePacket* queuedPacket : queued)
+                    delete queuedPacket;
+
+                queued.clear();
+            }
+
+            uint64 elapsed = uint64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+            handler->PSendSysMessage("    %s: %u ns per broadcast", shared ? "shared payload" : "copy per receiver", uint32(elapsed / count));
+        }
+
+        return true;
+    }
+
     static bool HandleDebugDummyCommand(ChatHandler* handler)
     {
         handler->SendSysMessage("This command does nothing right now. Edit your local core (cs_debug.cpp) to make it do whatever you need for testing.");
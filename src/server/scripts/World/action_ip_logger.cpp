@@ -167,7 +167,7 @@ public:
 class CharacterActionIpLogger : public PlayerScript
 {
 public:
-    CharacterActionIpLogger() : PlayerScript("CharacterActionIpLogger") { }
+    CharacterActionIpLogger() : PlayerScript("CharacterActionIpLogger", { }) { }
 
     // CHARACTER_CREATE = 7
     void OnCreate(Player* player) override
@@ -254,7 +254,7 @@ public:
 class CharacterDeleteActionIpLogger : public PlayerScript
 {
 public:
-    CharacterDeleteActionIpLogger() : PlayerScript("CharacterDeleteActionIpLogger") { }
+    CharacterDeleteActionIpLogger() : PlayerScript("CharacterDeleteActionIpLogger", { }) { }
 
     // CHARACTER_DELETE = 10
     void OnDelete(ObjectGuid guid, uint32 accountId) override
@@ -24,7 +24,7 @@
 class ServerMailReward : public PlayerScript
 {
 public:
-    ServerMailReward() : PlayerScript("ServerMailReward") { }
+    ServerMailReward() : PlayerScript("ServerMailReward", { }) { }
 
     // CHARACTER_LOGIN = 8
     void OnLogin(Player* player) override
@@ -18,6 +18,7 @@
 #include "DBCDatabaseLoader.h"
 #include "DatabaseEnv.h"
 #include "Errors.h"
+#include "QuerySnapshot.h"
 #include "StringFormat.h"
 
 DBCDatabaseLoader::DBCDatabaseLoader(char const* tableName, char const* dbcFormatString, std::vector<char*>& stringPool)
@@ -38,7 +39,7 @@ char* DBCDatabaseLoader::Load(uint32& records, char**& indexTable)
     std::string query = Acore::StringFormat("SELECT * FROM `%s` ORDER BY `ID` DESC", _sqlTableName);
 
     // no error if empty set
-    QueryResult result = WorldDatabase.Query(query.c_str());
+    QueryResult result = sQuerySnapshot->Query(_sqlTableName, query);
     if (!result)
         return nullptr;
 
@@ -40,7 +40,7 @@ public:
 
     AsyncAcceptor(Acore::Asio::IoContext& ioContext, std::string const& bindIp, uint16 port) :
         _acceptor(ioContext), _endpoint(Acore::Net::make_address(bindIp), port),
-        _socket(ioContext), _closed(false), _socketFactory(std::bind(&AsyncAcceptor::DefeaultSocketFactory, this))
+        _socket(ioContext), _closed(false), _reusePort(false), _socketFactory(std::bind(&AsyncAcceptor::DefeaultSocketFactory, this))
     {
     }
 
@@ -93,6 +93,18 @@ public:
         }
 #endif
 
+#ifdef SO_REUSEPORT
+        if (_reusePort)
+        {
+            _acceptor.set_option(boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>(true), errorCode);
+            if (errorCode)
+            {
+                LOG_INFO("network", "Failed to set reuse_port option on acceptor {}", errorCode.message());
+                return false;
+            }
+        }
+#endif
+
         _acceptor.bind(_endpoint, errorCode);
         if (errorCode)
         {
@@ -121,6 +133,19 @@ public:
 
     void SetSocketFactory(std::function<std::pair<tcp::socket*, uint32>()> func) { _socketFactory = func; }
 
+    /// Lets several acceptors listen on the same endpoint (SO_REUSEPORT), the kernel spreads incoming connections between them.
+    /// Must be set before Bind
+    void SetReusePort(bool enable) { _reusePort = enable; }
+
+    static constexpr bool IsReusePortSupported()
+    {
+#ifdef SO_REUSEPORT
+        return true;
+#else
+        return false;
+#endif
+    }
+
 private:
     std::pair<tcp::socket*, uint32> DefeaultSocketFactory() { return std::make_pair(&_socket, 0); }
 
@@ -128,6 +153,7 @@ private:
     tcp::endpoint _endpoint;
     tcp::socket _socket;
     std::atomic<bool> _closed;
+    bool _reusePort;
     std::function<std::pair<tcp::socket*, uint32>()> _socketFactory;
 };
 
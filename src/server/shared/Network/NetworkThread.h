@@ -23,6 +23,7 @@
 #include "Errors.h"
 #include "IoContext.h"
 #include "Log.h"
+#include "ProcessPriority.h"
 #include "Timer.h"
 #include <atomic>
 #include <boost/asio/ip/tcp.hpp>
@@ -38,8 +39,8 @@ template<class SocketType>
 class NetworkThread
 {
 public:
-    NetworkThread() : _connections(0), _stopped(false), _thread(nullptr), _ioContext(1),
-        _acceptSocket(_ioContext), _updateTimer(_ioContext) { }
+    NetworkThread() : _connections(0), _stopped(false), _thread(nullptr), _eventDrivenUpdates(false), _processor(-1),
+        _ioContext(1), _acceptSocket(_ioContext), _updateTimer(_ioContext) { }
 
     virtual ~NetworkThread()
     {
@@ -91,6 +92,13 @@ public:
     }
 
     tcp::socket* GetSocketForAccept() { return &_acceptSocket; }
+    Acore::Asio::IoContext& GetIoContext() { return _ioContext; }
+
+    /// Only sockets that scheduled an update, are closing or have data to write are updated, must be set before Start
+    void SetEventDrivenUpdates(bool enable) { _eventDrivenUpdates = enable; }
+
+    /// Pins the thread to the given processor once started, must be set before Start
+    void SetProcessor(int32 processor) { _processor = processor; }
 
 protected:
     virtual void SocketAdded(std::shared_ptr<SocketType> /*sock*/) { }
@@ -121,6 +129,9 @@ protected:
     {
         LOG_DEBUG("misc", "Network Thread Starting");
 
+        if (_processor >= 0)
+            SetThreadAffinity("network", _processor);
+
         _updateTimer.expires_from_now(boost::posix_time::milliseconds(10));
         _updateTimer.async_wait(std::bind(&NetworkThread<SocketType>::Update, this));
         _ioContext.run();
@@ -140,8 +151,11 @@ protected:
 
         AddNewSockets();
 
-        _sockets.erase(std::remove_if(_sockets.begin(), _sockets.end(), [this](std::shared_ptr<SocketType> sock)
+        _sockets.erase(std::remove_if(_sockets.begin(), _sockets.end(), [this](std::shared_ptr<SocketType> const& sock)
         {
+            if (_eventDrivenUpdates && !sock->NeedsUpdate())
+                return false;
+
             if (!sock->Update())
             {
                 if (sock->IsOpen())
@@ -165,6 +179,9 @@ private:
 
     std::thread* _thread;
 
+    bool _eventDrivenUpdates;
+    int32 _processor;
+
     SocketContainer _sockets;
 
     std::mutex _newSocketsLock;
@@ -22,14 +22,17 @@
 #include "MessageBuffer.h"
 #include <atomic>
 #include <boost/asio/ip/tcp.hpp>
+#include <deque>
 #include <functional>
 #include <memory>
-#include <queue>
 #include <type_traits>
+#include <vector>
 
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
+// asio does not pass more buffers than this to a single scatter/gather operation
+#define WRITE_BATCH_MAX_BUFFERS 64
 #ifdef BOOST_ASIO_HAS_IOCP
 #define AC_SOCKET_USE_IOCP
 #endif
@@ -39,9 +42,11 @@ class Socket : public std::enable_shared_from_this<T>
 {
 public:
     explicit Socket(tcp::socket&& socket) : _socket(std::move(socket)), _remoteAddress(_socket.remote_endpoint().address()),
-        _remotePort(_socket.remote_endpoint().port()), _readBuffer(), _closed(false), _closing(false), _isWritingAsync(false)
+        _remotePort(_socket.remote_endpoint().port()), _readBuffer(), _closed(false), _closing(false), _updateScheduled(false),
+        _isWritingAsync(false), _writeSyscalls(0), _writtenBytes(0)
     {
         _readBuffer.Resize(READ_BLOCK_SIZE);
+        _writeBatch.reserve(WRITE_BATCH_MAX_BUFFERS);
     }
 
     virtual ~Socket()
@@ -113,7 +118,7 @@ public:
 
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        _writeQueue.push_back(std::move(buffer));
 
 #ifdef AC_SOCKET_USE_IOCP
         AsyncProcessQueue();
@@ -140,8 +145,29 @@ public:
     /// Marks the socket for closing after write buffer becomes empty
     void DelayedCloseSocket() { _closing = true; }
 
+    /// Flags the socket as having work for its network thread, may be called from any thread
+    void ScheduleUpdate() { _updateScheduled.store(true, std::memory_order_release); }
+
+    /// Used by network threads with event driven updates to skip idle sockets, consumes the flag set by ScheduleUpdate
+    virtual bool NeedsUpdate()
+    {
+        if (_updateScheduled.load(std::memory_order_relaxed) && _updateScheduled.exchange(false, std::memory_order_acq_rel))
+            return true;
+
+        return _closed || _closing || (!_isWritingAsync && !_writeQueue.empty());
+    }
+
     MessageBuffer& GetReadBuffer() { return _readBuffer; }
 
+    /// Returns the number of write syscalls and the bytes they sent since the previous call
+    void TakeWriteStatistics(uint32& syscalls, std::size_t& bytes)
+    {
+        syscalls = _writeSyscalls;
+        bytes = _writtenBytes;
+        _writeSyscalls = 0;
+        _writtenBytes = 0;
+    }
+
 protected:
     virtual void OnClose() { }
     virtual void ReadHandler() = 0;
@@ -154,8 +180,8 @@ protected:
         _isWritingAsync = true;
 
 #ifdef AC_SOCKET_USE_IOCP
-        MessageBuffer& buffer = _writeQueue.front();
-        _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(), buffer.GetActiveSize()), std::bind(&Socket<T>::WriteHandler,
+        PrepareWriteBatch();
+        _socket.async_write_some(_writeBatch, std::bind(&Socket<T>::WriteHandler,
             this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
 #else
         _socket.async_write_some(boost::asio::null_buffers(), std::bind(&Socket<T>::WriteHandlerWrapper,
@@ -175,6 +201,41 @@ protected:
     }
 
 private:
+    /// Gathers the front of the write queue into one scatter/gather batch, returns the number of bytes in it
+    std::size_t PrepareWriteBatch()
+    {
+        _writeBatch.clear();
+
+        std::size_t bytes = 0;
+        for (auto itr = _writeQueue.begin(); itr != _writeQueue.end() && _writeBatch.size() < WRITE_BATCH_MAX_BUFFERS; ++itr)
+        {
+            _writeBatch.emplace_back(itr->GetReadPointer(), itr->GetActiveSize());
+            bytes += itr->GetActiveSize();
+        }
+
+        return bytes;
+    }
+
+    /// Drops the fully sent buffers of the write queue and advances the partially sent one
+    void WriteCompleted(std::size_t bytesSent)
+    {
+        ++_writeSyscalls;
+        _writtenBytes += bytesSent;
+
+        while (bytesSent && !_writeQueue.empty())
+        {
+            MessageBuffer& buffer = _writeQueue.front();
+            if (bytesSent < buffer.GetActiveSize())
+            {
+                buffer.ReadCompleted(bytesSent);
+                return;
+            }
+
+            bytesSent -= buffer.GetActiveSize();
+            _writeQueue.pop_front();
+        }
+    }
+
     void ReadHandlerInternal(boost::system::error_code error, size_t transferredBytes)
     {
         if (error)
@@ -193,10 +254,7 @@ private:
         if (!error)
         {
             _isWritingAsync = false;
-            _writeQueue.front().ReadCompleted(transferedBytes);
-
-            if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+            WriteCompleted(transferedBytes);
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -220,12 +278,11 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        // every buffer queued since the last write goes out with a single writev
+        std::size_t bytesToSend = PrepareWriteBatch();
 
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        std::size_t bytesSent = _socket.write_some(_writeBatch, error);
 
         if (error)
         {
@@ -234,7 +291,7 @@ private:
                 return AsyncProcessQueue();
             }
 
-            _writeQueue.pop();
+            _writeQueue.pop_front();
 
             if (_closing && _writeQueue.empty())
             {
@@ -245,7 +302,7 @@ private:
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            _writeQueue.pop_front();
 
             if (_closing && _writeQueue.empty())
             {
@@ -254,14 +311,14 @@ private:
 
             return false;
         }
-        else if (bytesSent < bytesToSend) // now n > 0
+
+        WriteCompleted(bytesSent);
+
+        if (bytesSent < bytesToSend) // kernel buffer is full, wait until the socket is writable again
         {
-            queuedMessage.ReadCompleted(bytesSent);
             return AsyncProcessQueue();
         }
 
-        _writeQueue.pop();
-
         if (_closing && _writeQueue.empty())
         {
             CloseSocket();
@@ -277,12 +334,17 @@ private:
     uint16 _remotePort;
 
     MessageBuffer _readBuffer;
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<MessageBuffer> _writeQueue;
+    std::vector<boost::asio::const_buffer> _writeBatch;
 
     std::atomic<bool> _closed;
     std::atomic<bool> _closing;
+    std::atomic<bool> _updateScheduled;
 
     bool _isWritingAsync;
+
+    uint32 _writeSyscalls;
+    std::size_t _writtenBytes;
 };
 
 #endif // __SOCKET_H__
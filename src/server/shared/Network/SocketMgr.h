@@ -21,8 +21,10 @@
 #include "AsyncAcceptor.h"
 #include "Errors.h"
 #include "NetworkThread.h"
+#include <bit>
 #include <boost/asio/ip/tcp.hpp>
 #include <memory>
+#include <vector>
 
 using boost::asio::ip::tcp;
 
@@ -32,29 +34,25 @@ class SocketMgr
 public:
     virtual ~SocketMgr()
     {
-        ASSERT(!_threads && !_acceptor && !_threadCount, "StopNetwork must be called prior to SocketMgr destruction");
+        ASSERT(!_threads && !_acceptor && _threadAcceptors.empty() && !_threadCount, "StopNetwork must be called prior to SocketMgr destruction");
     }
 
     virtual bool StartNetwork(Acore::Asio::IoContext& ioContext, std::string const& bindIp, uint16 port, int threadCount)
     {
         ASSERT(threadCount > 0);
 
-        AsyncAcceptor* acceptor = nullptr;
-        try
+        if (_reusePort && !AsyncAcceptor::IsReusePortSupported())
         {
-            acceptor = new AsyncAcceptor(ioContext, bindIp, port);
-        }
-        catch (boost::system::system_error const& err)
-        {
-            LOG_ERROR("network", "Exception caught in SocketMgr.StartNetwork ({}:{}): {}", bindIp, port, err.what());
-            return false;
+            LOG_ERROR("network", "SO_REUSEPORT is not supported on this platform, using a single acceptor");
+            _reusePort = false;
         }
 
-        if (!acceptor->Bind())
+        AsyncAcceptor* acceptor = nullptr;
+        if (!_reusePort)
         {
-            LOG_ERROR("network", "StartNetwork failed to bind socket acceptor");
-            delete acceptor;
-            return false;
+            acceptor = CreateAcceptor(ioContext, bindIp, port);
+            if (!acceptor)
+                return false;
         }
 
         _acceptor = acceptor;
@@ -63,17 +61,54 @@ public:
 
         ASSERT(_threads);
 
+        for (int32 i = 0; i < _threadCount; ++i)
+        {
+            _threads[i].SetEventDrivenUpdates(_eventDrivenUpdates);
+            _threads[i].SetProcessor(GetProcessorForThread(i));
+        }
+
+        // every network thread accepts its own connections, no socket is handed over between threads
+        if (_reusePort)
+        {
+            for (int32 i = 0; i < _threadCount; ++i)
+            {
+                AsyncAcceptor* threadAcceptor = CreateAcceptor(_threads[i].GetIoContext(), bindIp, port);
+                if (!threadAcceptor)
+                {
+                    for (AsyncAcceptor* createdAcceptor : _threadAcceptors)
+                        delete createdAcceptor;
+
+                    _threadAcceptors.clear();
+                    delete[] _threads;
+                    _threads = nullptr;
+                    _threadCount = 0;
+                    return false;
+                }
+
+                NetworkThread<SocketType>* thread = &_threads[i];
+                threadAcceptor->SetSocketFactory([thread, i]() { return std::make_pair(thread->GetSocketForAccept(), uint32(i)); });
+                _threadAcceptors.push_back(threadAcceptor);
+            }
+
+            LOG_INFO("network", "{} network threads accept connections on {}:{} through SO_REUSEPORT", _threadCount, bindIp, port);
+        }
+
         for (int32 i = 0; i < _threadCount; ++i)
             _threads[i].Start();
 
-        _acceptor->SetSocketFactory([this]() { return GetSocketForAccept(); });
+        if (_acceptor)
+            _acceptor->SetSocketFactory([this]() { return GetSocketForAccept(); });
 
         return true;
     }
 
     virtual void StopNetwork()
     {
-        _acceptor->Close();
+        if (_acceptor)
+            _acceptor->Close();
+
+        for (AsyncAcceptor* threadAcceptor : _threadAcceptors)
+            threadAcceptor->Close();
 
         if (_threadCount != 0)
             for (int32 i = 0; i < _threadCount; ++i)
@@ -83,11 +118,25 @@ public:
 
         delete _acceptor;
         _acceptor = nullptr;
+        for (AsyncAcceptor* threadAcceptor : _threadAcceptors)
+            delete threadAcceptor;
+        _threadAcceptors.clear();
         delete[] _threads;
         _threads = nullptr;
         _threadCount = 0;
     }
 
+    /// Starts accepting connections on the shared acceptor or on the acceptor of every network thread
+    template<AsyncAcceptor::AcceptCallback acceptCallback>
+    void StartAccepting()
+    {
+        if (_acceptor)
+            _acceptor->AsyncAcceptWithCallback<acceptCallback>();
+
+        for (AsyncAcceptor* threadAcceptor : _threadAcceptors)
+            threadAcceptor->AsyncAcceptWithCallback<acceptCallback>();
+    }
+
     void Wait()
     {
         if (_threadCount != 0)
@@ -131,13 +180,59 @@ public:
 
 protected:
     SocketMgr() :
-        _acceptor(nullptr), _threads(nullptr), _threadCount(0) { }
+        _acceptor(nullptr), _threads(nullptr), _threadCount(0), _reusePort(false), _eventDrivenUpdates(false), _threadAffinity(0) { }
 
     virtual NetworkThread<SocketType>* CreateThreads() const = 0;
 
     AsyncAcceptor* _acceptor;
+    std::vector<AsyncAcceptor*> _threadAcceptors;
     NetworkThread<SocketType>* _threads;
     int32 _threadCount;
+
+    // set by derived managers before StartNetwork
+    bool _reusePort;
+    bool _eventDrivenUpdates;
+    uint32 _threadAffinity;
+
+private:
+    AsyncAcceptor* CreateAcceptor(Acore::Asio::IoContext& ioContext, std::string const& bindIp, uint16 port) const
+    {
+        AsyncAcceptor* acceptor = nullptr;
+        try
+        {
+            acceptor = new AsyncAcceptor(ioContext, bindIp, port);
+        }
+        catch (boost::system::system_error const& err)
+        {
+            LOG_ERROR("network", "Exception caught in SocketMgr.StartNetwork ({}:{}): {}", bindIp, port, err.what());
+            return nullptr;
+        }
+
+        acceptor->SetReusePort(_reusePort);
+        if (!acceptor->Bind())
+        {
+            LOG_ERROR("network", "StartNetwork failed to bind socket acceptor");
+            delete acceptor;
+            return nullptr;
+        }
+
+        return acceptor;
+    }
+
+    /// Network threads are spread over the processors set in _threadAffinity, -1 when they are not pinned
+    int32 GetProcessorForThread(int32 threadIndex) const
+    {
+        uint32 processorCount = std::popcount(_threadAffinity);
+        if (!processorCount)
+            return -1;
+
+        uint32 skip = uint32(threadIndex) % processorCount;
+        uint32 mask = _threadAffinity;
+        for (; skip; --skip)
+            mask &= mask - 1;
+
+        return std::countr_zero(mask);
+    }
 };
 
 #endif // SocketMgr_h__
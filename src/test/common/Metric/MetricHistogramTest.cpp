@@ -0,0 +1,61 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Metric.h"
+#include "gtest/gtest.h"
+#include <limits>
+
+TEST(MetricHistogramTest, SmallValuesAreExact)
+{
+    for (uint64 value = 0; value < MetricHistogram::SUB_BUCKETS; ++value)
+    {
+        EXPECT_EQ(MetricHistogram::GetBucket(value), value);
+        EXPECT_EQ(MetricHistogram::GetBucketUpperBound(uint32(value)), value);
+    }
+}
+
+TEST(MetricHistogramTest, BucketBoundaries)
+{
+    EXPECT_EQ(MetricHistogram::GetBucket(MetricHistogram::GetBucketUpperBound(0)), 0u);
+
+    for (uint32 bucket = 1; bucket < MetricHistogram::BUCKET_COUNT; ++bucket)
+    {
+        uint64 lowerBound = MetricHistogram::GetBucketUpperBound(bucket - 1) + 1;
+        uint64 upperBound = MetricHistogram::GetBucketUpperBound(bucket);
+        ASSERT_LE(lowerBound, upperBound) << "bucket " << bucket;
+        EXPECT_EQ(MetricHistogram::GetBucket(lowerBound), bucket);
+        EXPECT_EQ(MetricHistogram::GetBucket(upperBound), bucket);
+    }
+}
+
+TEST(MetricHistogramTest, UpperBoundIsWithinRelativeError)
+{
+    for (uint64 value = 1; value < (uint64(1) << MetricHistogram::MAX_EXPONENT); value = value * 3 / 2 + 1)
+    {
+        uint64 upperBound = MetricHistogram::GetBucketUpperBound(MetricHistogram::GetBucket(value));
+        EXPECT_GE(upperBound, value);
+        EXPECT_LE(upperBound - value, value / MetricHistogram::SUB_BUCKETS) << "value " << value;
+    }
+}
+
+TEST(MetricHistogramTest, LargeValuesGoToLastBucket)
+{
+    uint32 lastBucket = MetricHistogram::BUCKET_COUNT - 1;
+    EXPECT_EQ(MetricHistogram::GetBucket((uint64(1) << MetricHistogram::MAX_EXPONENT) - 1), lastBucket);
+    EXPECT_EQ(MetricHistogram::GetBucket(uint64(1) << MetricHistogram::MAX_EXPONENT), lastBucket);
+    EXPECT_EQ(MetricHistogram::GetBucket(std::numeric_limits<uint64>::max()), lastBucket);
+}
@@ -0,0 +1,82 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CharacterNameHash.h"
+#include "gtest/gtest.h"
+#include <string>
+#include <unordered_map>
+
+TEST(CharacterNameHashTest, AsciiIgnoresCase)
+{
+    CharacterNameHash hash;
+    CharacterNameEqual equal;
+
+    EXPECT_TRUE(equal("Arthas", "arthas"));
+    EXPECT_TRUE(equal("ARTHAS", "aRtHaS"));
+    EXPECT_EQ(hash("Arthas"), hash("arthas"));
+    EXPECT_EQ(hash("ARTHAS"), hash("aRtHaS"));
+}
+
+TEST(CharacterNameHashTest, DifferentNamesAreNotEqual)
+{
+    CharacterNameEqual equal;
+
+    EXPECT_FALSE(equal("Arthas", "Arthus"));
+    EXPECT_FALSE(equal("Arthas", "Artha"));
+    EXPECT_FALSE(equal("Artha", "Arthas"));
+    EXPECT_FALSE(equal("", "a"));
+    EXPECT_TRUE(equal("", ""));
+}
+
+TEST(CharacterNameHashTest, Utf8IgnoresCase)
+{
+    CharacterNameHash hash;
+    CharacterNameEqual equal;
+
+    // "Ævar" / "ævar", "Élodie" / "élodie", "Дмитрий" / "дмитрий"
+    EXPECT_TRUE(equal("\xC3\x86var", "\xC3\xA6var"));
+    EXPECT_EQ(hash("\xC3\x86var"), hash("\xC3\xA6var"));
+    EXPECT_TRUE(equal("\xC3\x89lodie", "\xC3\xA9lodie"));
+    EXPECT_EQ(hash("\xC3\x89lodie"), hash("\xC3\xA9lodie"));
+    EXPECT_TRUE(equal("\xD0\x94\xD0\xBC\xD0\xB8\xD1\x82\xD1\x80\xD0\xB8\xD0\xB9", "\xD0\xB4\xD0\xBC\xD0\xB8\xD1\x82\xD1\x80\xD0\xB8\xD0\xB9"));
+    EXPECT_EQ(hash("\xD0\x94\xD0\xBC\xD0\xB8\xD1\x82\xD1\x80\xD0\xB8\xD0\xB9"), hash("\xD0\xB4\xD0\xBC\xD0\xB8\xD1\x82\xD1\x80\xD0\xB8\xD0\xB9"));
+
+    // "Éva" and "Eva" are different names
+    EXPECT_FALSE(equal("\xC3\x89va", "Eva"));
+}
+
+TEST(CharacterNameHashTest, InvalidUtf8IsComparedByteWise)
+{
+    CharacterNameHash hash;
+    CharacterNameEqual equal;
+
+    EXPECT_TRUE(equal("Ab\xFF", "aB\xFF"));
+    EXPECT_EQ(hash("Ab\xFF"), hash("aB\xFF"));
+    EXPECT_FALSE(equal("Ab\xFF", "Ab\xFE"));
+}
+
+TEST(CharacterNameHashTest, TransparentLookup)
+{
+    std::unordered_map<std::string, uint32, CharacterNameHash, CharacterNameEqual> names;
+    names.emplace("Jaina", 1);
+    names.emplace("Thrall", 2);
+
+    EXPECT_EQ(names.find(std::string_view("JAINA"))->second, 1u);
+    EXPECT_EQ(names.find(std::string_view("thrall"))->second, 2u);
+    EXPECT_EQ(names.find(std::string_view("Sylvanas")), names.end());
+    EXPECT_FALSE(names.emplace("jaina", 3).second);
+}
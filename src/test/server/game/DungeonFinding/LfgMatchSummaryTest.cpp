@@ -0,0 +1,148 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Group.h"
+#include "LFGMgr.h"
+#include "gtest/gtest.h"
+#include <random>
+
+using namespace lfg;
+
+namespace
+{
+    constexpr uint32 DUNGEON_COUNT = 4;
+
+    struct QueueEntryMock
+    {
+        LfgRolesMap Roles;
+        LfgMatchSummary Summary;
+    };
+
+    // same summary as LFGQueue::BuildMatchSummary, dungeon i of the mask is bit i
+    QueueEntryMock CreateEntry(std::mt19937& rng, uint32& nextGuid, uint8 players, bool lfgGroup)
+    {
+        QueueEntryMock entry;
+        for (uint8 i = 0; i < players; ++i)
+        {
+            uint8 roles = uint8(std::uniform_int_distribution<uint32>(PLAYER_ROLE_NONE, PLAYER_ROLE_LEADER | PLAYER_ROLE_TANK | PLAYER_ROLE_HEALER | PLAYER_ROLE_DAMAGE)(rng));
+            entry.Roles[ObjectGuid::Create<HighGuid::Player>(++nextGuid)] = roles;
+            ++entry.Summary.roleCounts[(roles >> 1) & 7];
+        }
+
+        uint32 dungeons = std::uniform_int_distribution<uint32>(1, (1 << DUNGEON_COUNT) - 1)(rng);
+        for (uint32 i = 0; i < DUNGEON_COUNT; ++i)
+            if (dungeons & (1 << i))
+                entry.Summary.dungeons.set(i);
+
+        entry.Summary.players = players;
+        entry.Summary.lfgGroups = lfgGroup ? 1 : 0;
+        return entry;
+    }
+
+    bool CanFormGroup(QueueEntryMock const& first, QueueEntryMock const& second)
+    {
+        if (first.Roles.size() + second.Roles.size() > MAXGROUPSIZE || first.Summary.lfgGroups + second.Summary.lfgGroups > 1)
+            return false;
+
+        if ((first.Summary.dungeons & second.Summary.dungeons).none())
+            return false;
+
+        LfgRolesMap roles = first.Roles;
+        roles.insert(second.Roles.begin(), second.Roles.end());
+        return LFGMgr::CheckGroupRoles(roles) != 0;
+    }
+}
+
+TEST(LfgMatchSummaryTest, CanMatchAgreesWithCheckGroupRoles)
+{
+    std::mt19937 rng(20261019);
+    uint32 nextGuid = 0;
+
+    for (uint32 i = 0; i < 20000; ++i)
+    {
+        uint8 firstPlayers = uint8(std::uniform_int_distribution<uint32>(1, MAXGROUPSIZE)(rng));
+        uint8 secondPlayers = uint8(std::uniform_int_distribution<uint32>(1, MAXGROUPSIZE)(rng));
+        QueueEntryMock first = CreateEntry(rng, nextGuid, firstPlayers, firstPlayers > 1 && !(i % 7));
+        QueueEntryMock second = CreateEntry(rng, nextGuid, secondPlayers, secondPlayers > 1 && !(i % 11));
+
+        bool expected = CanFormGroup(first, second);
+        ASSERT_EQ(first.Summary.CanMatch(second.Summary), expected) << "iteration " << i;
+        ASSERT_EQ(second.Summary.CanMatch(first.Summary), expected) << "iteration " << i;
+    }
+}
+
+TEST(LfgMatchSummaryTest, AddMatchesSummaryOfMergedEntries)
+{
+    std::mt19937 rng(42);
+    uint32 nextGuid = 0;
+
+    for (uint32 i = 0; i < 5000; ++i)
+    {
+        QueueEntryMock first = CreateEntry(rng, nextGuid, 1, false);
+        QueueEntryMock second = CreateEntry(rng, nextGuid, 1, false);
+        QueueEntryMock third = CreateEntry(rng, nextGuid, uint8(std::uniform_int_distribution<uint32>(1, 3)(rng)), false);
+
+        // the matcher checks new entrants against partial groups built with Add
+        LfgMatchSummary partial = first.Summary;
+        partial.Add(second.Summary);
+
+        QueueEntryMock merged = first;
+        merged.Roles.insert(second.Roles.begin(), second.Roles.end());
+        merged.Summary = partial;
+
+        ASSERT_EQ(partial.CanMatch(third.Summary), CanFormGroup(merged, third)) << "iteration " << i;
+    }
+}
+
+TEST(LfgMatchSummaryTest, RolesWithoutSlotAreRejected)
+{
+    LfgMatchSummary tanks;
+    tanks.dungeons.set(0);
+    tanks.roleCounts[PLAYER_ROLE_TANK >> 1] = 1;
+    tanks.players = 1;
+
+    LfgMatchSummary otherTank = tanks;
+    EXPECT_FALSE(tanks.CanMatch(otherTank));
+
+    LfgMatchSummary flexible = tanks;
+    flexible.roleCounts = { };
+    flexible.roleCounts[(PLAYER_ROLE_TANK | PLAYER_ROLE_HEALER) >> 1] = 1;
+    EXPECT_TRUE(tanks.CanMatch(flexible));
+
+    LfgMatchSummary noRole = tanks;
+    noRole.roleCounts = { };
+    noRole.roleCounts[0] = 1;
+    EXPECT_FALSE(tanks.CanMatch(noRole));
+}
+
+TEST(LfgMatchSummaryTest, DisjointDungeonsAreRejected)
+{
+    LfgMatchSummary tank;
+    tank.dungeons.set(0);
+    tank.roleCounts[PLAYER_ROLE_TANK >> 1] = 1;
+    tank.players = 1;
+
+    LfgMatchSummary healer;
+    healer.dungeons.set(1);
+    healer.roleCounts[PLAYER_ROLE_HEALER >> 1] = 1;
+    healer.players = 1;
+
+    EXPECT_FALSE(tank.CanMatch(healer));
+
+    healer.dungeons.set(0);
+    EXPECT_TRUE(tank.CanMatch(healer));
+}
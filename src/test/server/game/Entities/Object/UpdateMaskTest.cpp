@@ -0,0 +1,56 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "UpdateFieldFlags.h"
+#include "UpdateMask.h"
+#include "gtest/gtest.h"
+
+TEST(UpdateMaskTest, AppendToPacket)
+{
+    UpdateMask mask;
+    mask.SetCount(UNIT_END);
+
+    mask.SetBit(0);
+    mask.SetBit(31);
+    mask.SetBit(32);
+    mask.SetBit(UNIT_END - 1);
+    mask.UnsetBit(0);
+
+    ByteBuffer data;
+    mask.AppendToPacket(&data);
+
+    ASSERT_EQ(data.size(), mask.GetBlockCount() * sizeof(UpdateMask::ClientUpdateMaskType));
+    EXPECT_EQ(data.read<uint32>(0), 0x80000000);
+    EXPECT_EQ(data.read<uint32>(4), 0x00000001);
+    EXPECT_EQ(data.read<uint32>((mask.GetBlockCount() - 1) * 4), UpdateMask::GetBlockBit(UNIT_END - 1));
+}
+
+TEST(UpdateMaskTest, FlagsBlock)
+{
+    for (uint32 block = 0; block * UpdateMask::CLIENT_UPDATE_MASK_BITS < PLAYER_END; ++block)
+    {
+        uint32 expected = 0;
+        for (uint32 bit = 0; bit < UpdateMask::CLIENT_UPDATE_MASK_BITS; ++bit)
+        {
+            uint32 index = block * UpdateMask::CLIENT_UPDATE_MASK_BITS + bit;
+            if (index < PLAYER_END && UnitUpdateFieldFlags[index] & (UF_FLAG_PUBLIC | UF_FLAG_PARTY_MEMBER))
+                expected |= UpdateMask::GetBlockBit(index);
+        }
+
+        EXPECT_EQ(GetUpdateFieldFlagsBlock(UnitUpdateFieldFlags, UF_FLAG_PUBLIC | UF_FLAG_PARTY_MEMBER, block), expected);
+    }
+}
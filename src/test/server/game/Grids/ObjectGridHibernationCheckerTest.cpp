@@ -0,0 +1,53 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectGridLoader.h"
+#include "ZoneScript.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    struct SpawnMock
+    {
+        ObjectGuid::LowType SpawnId = 0;
+        ZoneScript* Script = nullptr;
+
+        [[nodiscard]] ObjectGuid::LowType GetSpawnId() const { return SpawnId; }
+        [[nodiscard]] ZoneScript* GetZoneScript() const { return Script; }
+    };
+}
+
+TEST(ObjectGridHibernationCheckerTest, DatabaseSpawnIsReloaded)
+{
+    SpawnMock spawn{ 1234, nullptr };
+    EXPECT_TRUE(ObjectGridHibernationChecker::IsReloadedWithGrid(&spawn));
+}
+
+TEST(ObjectGridHibernationCheckerTest, SummonIsNotReloaded)
+{
+    SpawnMock summon{ 0, nullptr };
+    EXPECT_FALSE(ObjectGridHibernationChecker::IsReloadedWithGrid(&summon));
+}
+
+TEST(ObjectGridHibernationCheckerTest, ZoneScriptObjectIsNotReloaded)
+{
+    ZoneScript battlefield;
+    SpawnMock scripted{ 0, &battlefield };
+    SpawnMock tracked{ 1234, &battlefield };
+    EXPECT_FALSE(ObjectGridHibernationChecker::IsReloadedWithGrid(&scripted));
+    EXPECT_FALSE(ObjectGridHibernationChecker::IsReloadedWithGrid(&tracked));
+}
@@ -0,0 +1,102 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "VisibilityCache.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    struct WorldObjectMock
+    {
+        float X = 0.0f, Y = 0.0f, Z = 0.0f;
+        uint32 VisibilityStamp = 0;
+
+        [[nodiscard]] uint32 GetVisibilityStamp() const { return VisibilityStamp; }
+
+        [[nodiscard]] float GetExactDistSq(float x, float y, float z) const
+        {
+            float dx = X - x, dy = Y - y, dz = Z - z;
+            return dx * dx + dy * dy + dz * dz;
+        }
+    };
+
+    constexpr uint32 CACHE_DURATION = 1000;
+
+    VisibilityCache::Entry CreateEntry(WorldObjectMock const& observer, WorldObjectMock const& target, uint32 now)
+    {
+        return { observer.X, observer.Y, observer.Z, target.X, target.Y, target.Z,
+            observer.GetVisibilityStamp(), target.GetVisibilityStamp(), now, true };
+    }
+}
+
+TEST(VisibilityCacheTest, UnchangedPairIsCurrent)
+{
+    WorldObjectMock observer{ 10.0f, 10.0f, 0.0f, 3 };
+    WorldObjectMock target{ 50.0f, 10.0f, 0.0f, 7 };
+    VisibilityCache::Entry entry = CreateEntry(observer, target, 5000);
+
+    EXPECT_TRUE(VisibilityCache::IsEntryCurrent(entry, &observer, &target, 5000, CACHE_DURATION));
+    EXPECT_TRUE(VisibilityCache::IsEntryCurrent(entry, &observer, &target, 5000 + CACHE_DURATION - 1, CACHE_DURATION));
+}
+
+TEST(VisibilityCacheTest, ExpiredEntryIsInvalidated)
+{
+    WorldObjectMock observer;
+    WorldObjectMock target{ 20.0f, 0.0f, 0.0f, 0 };
+    VisibilityCache::Entry entry = CreateEntry(observer, target, 5000);
+
+    EXPECT_FALSE(VisibilityCache::IsEntryCurrent(entry, &observer, &target, 5000 + CACHE_DURATION, CACHE_DURATION));
+
+    // game time wrapped around since the check
+    VisibilityCache::Entry wrapped = CreateEntry(observer, target, 0xFFFFFF00);
+    EXPECT_TRUE(VisibilityCache::IsEntryCurrent(wrapped, &observer, &target, 0x10, CACHE_DURATION));
+    EXPECT_FALSE(VisibilityCache::IsEntryCurrent(wrapped, &observer, &target, CACHE_DURATION, CACHE_DURATION));
+}
+
+TEST(VisibilityCacheTest, StampChangeInvalidates)
+{
+    WorldObjectMock observer;
+    WorldObjectMock target{ 20.0f, 0.0f, 0.0f, 0 };
+    VisibilityCache::Entry entry = CreateEntry(observer, target, 5000);
+
+    // the target despawned and respawned at the same place
+    ++target.VisibilityStamp;
+    EXPECT_FALSE(VisibilityCache::IsEntryCurrent(entry, &observer, &target, 5000, CACHE_DURATION));
+
+    --target.VisibilityStamp;
+    // the observer gained or lost an aura changing what it can detect
+    ++observer.VisibilityStamp;
+    EXPECT_FALSE(VisibilityCache::IsEntryCurrent(entry, &observer, &target, 5000, CACHE_DURATION));
+}
+
+TEST(VisibilityCacheTest, MovementInvalidates)
+{
+    WorldObjectMock observer;
+    WorldObjectMock target{ 20.0f, 0.0f, 0.0f, 0 };
+    VisibilityCache::Entry entry = CreateEntry(observer, target, 5000);
+
+    observer.X += VISIBILITY_CACHE_MOVE_DISTANCE * 0.5f;
+    target.Z += VISIBILITY_CACHE_MOVE_DISTANCE * 0.5f;
+    EXPECT_TRUE(VisibilityCache::IsEntryCurrent(entry, &observer, &target, 5000, CACHE_DURATION));
+
+    target.Y += VISIBILITY_CACHE_MOVE_DISTANCE * 2.0f;
+    EXPECT_FALSE(VisibilityCache::IsEntryCurrent(entry, &observer, &target, 5000, CACHE_DURATION));
+
+    target.Y = 0.0f;
+    observer.X = -VISIBILITY_CACHE_MOVE_DISTANCE * 2.0f;
+    EXPECT_FALSE(VisibilityCache::IsEntryCurrent(entry, &observer, &target, 5000, CACHE_DURATION));
+}
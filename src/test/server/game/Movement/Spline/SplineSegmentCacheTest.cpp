@@ -0,0 +1,116 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SplineSegmentCache.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+using namespace Movement;
+
+namespace
+{
+    // a path no other test of the cache uses, offset moves it away from the others
+    std::vector<Vector3> CreatePath(uint32 count, float offset)
+    {
+        std::vector<Vector3> path;
+        for (uint32 i = 0; i < count; ++i)
+            path.emplace_back(offset + float(i) * 5.0f, offset + float(i % 3) * 2.0f, float(i % 2));
+
+        return path;
+    }
+
+    void InitSpline(Spline<int32>& spline, std::vector<Vector3> const& path, SplineBase::EvaluationMode mode = SplineBase::ModeCatmullrom)
+    {
+        spline.init_spline(path.data(), path.size(), mode);
+    }
+
+    void ExpectLengthsOf(Spline<int32> const& spline, SplineSegmentLengths const& lengths)
+    {
+        for (std::size_t i = 0; i < lengths.Lengths.size(); ++i)
+        {
+            SplineBase::index_type segment = lengths.First + SplineBase::index_type(i);
+            EXPECT_FLOAT_EQ(lengths.Lengths[i], spline.SegLength(segment)) << "segment " << segment;
+        }
+    }
+}
+
+TEST(SplineSegmentCacheTest, ShortAndLinearPathsAreNotCached)
+{
+    Spline<int32> spline;
+    InitSpline(spline, CreatePath(4, 1000.0f));
+    EXPECT_EQ(sSplineSegmentCache->GetSegmentLengths(spline), nullptr);
+
+    InitSpline(spline, CreatePath(40, 1000.0f), SplineBase::ModeLinear);
+    EXPECT_EQ(sSplineSegmentCache->GetSegmentLengths(spline), nullptr);
+}
+
+TEST(SplineSegmentCacheTest, SamePathIsShared)
+{
+    std::vector<Vector3> path = CreatePath(40, 2000.0f);
+    Spline<int32> first;
+    InitSpline(first, path);
+    std::shared_ptr<SplineSegmentLengths const> lengths = sSplineSegmentCache->GetSegmentLengths(first);
+    ASSERT_NE(lengths, nullptr);
+    ExpectLengthsOf(first, *lengths);
+
+    // the first control point is the position of the moving unit and not part of the cached segments
+    path[0].z += 3.0f;
+    Spline<int32> second;
+    InitSpline(second, path);
+    EXPECT_EQ(sSplineSegmentCache->GetSegmentLengths(second), lengths);
+}
+
+TEST(SplineSegmentCacheTest, ChangedPathIsNotShared)
+{
+    std::vector<Vector3> path = CreatePath(40, 3000.0f);
+    Spline<int32> first;
+    InitSpline(first, path);
+    std::shared_ptr<SplineSegmentLengths const> lengths = sSplineSegmentCache->GetSegmentLengths(first);
+    ASSERT_NE(lengths, nullptr);
+
+    path[20].y += 10.0f;
+    Spline<int32> second;
+    InitSpline(second, path);
+    std::shared_ptr<SplineSegmentLengths const> changedLengths = sSplineSegmentCache->GetSegmentLengths(second);
+    ASSERT_NE(changedLengths, nullptr);
+    EXPECT_NE(changedLengths, lengths);
+    ExpectLengthsOf(second, *changedLengths);
+
+    // the last control point only shapes the last segment
+    path[20].y -= 10.0f;
+    path.back().x += 10.0f;
+    Spline<int32> third;
+    InitSpline(third, path);
+    std::shared_ptr<SplineSegmentLengths const> lastChangedLengths = sSplineSegmentCache->GetSegmentLengths(third);
+    ASSERT_NE(lastChangedLengths, nullptr);
+    EXPECT_NE(lastChangedLengths, lengths);
+    ExpectLengthsOf(third, *lastChangedLengths);
+}
+
+TEST(SplineSegmentCacheTest, CyclicPathsAreCached)
+{
+    std::vector<Vector3> path = CreatePath(40, 4000.0f);
+    Spline<int32> first;
+    first.init_cyclic_spline(path.data(), path.size(), SplineBase::ModeCatmullrom, 1);
+    std::shared_ptr<SplineSegmentLengths const> lengths = sSplineSegmentCache->GetSegmentLengths(first);
+    ASSERT_NE(lengths, nullptr);
+    ExpectLengthsOf(first, *lengths);
+
+    Spline<int32> second;
+    second.init_cyclic_spline(path.data(), path.size(), SplineBase::ModeCatmullrom, 1);
+    EXPECT_EQ(sSplineSegmentCache->GetSegmentLengths(second), lengths);
+}
@@ -0,0 +1,122 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Prints the records of a binary log file written by AppenderBinary (Appender type 4) as text lines,
+ * optionally filtered by log level and log filter type prefix.
+ */
+
+#include "AppenderBinary.h"
+#include "ByteConverter.h"
+#include "StringConvert.h"
+#include "Timer.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+    char const* GetLevelString(uint8 level)
+    {
+        switch (level)
+        {
+            case LOG_LEVEL_FATAL: return "FATAL";
+            case LOG_LEVEL_ERROR: return "ERROR";
+            case LOG_LEVEL_WARN:  return "WARN";
+            case LOG_LEVEL_INFO:  return "INFO";
+            case LOG_LEVEL_DEBUG: return "DEBUG";
+            case LOG_LEVEL_TRACE: return "TRACE";
+            default:              return "?";
+        }
+    }
+
+    template<typename T>
+    bool Read(FILE* file, T& value)
+    {
+        if (fread(&value, sizeof(T), 1, file) != 1)
+            return false;
+
+        EndianConvert(value);
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        printf("Usage: %s <binary log file> [max log level = 6] [filter type prefix]\n", argv[0]);
+        return 1;
+    }
+
+    uint8 maxLevel = argc > 2 ? Acore::StringTo<uint8>(argv[2]).value_or(LOG_LEVEL_TRACE) : uint8(LOG_LEVEL_TRACE);
+    std::string typePrefix = argc > 3 ? argv[3] : "";
+
+    FILE* file = fopen(argv[1], "rb");
+    if (!file)
+    {
+        printf("Cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    char magic[sizeof(AppenderBinary::FILE_MAGIC)];
+    uint8 version = 0;
+    if (fread(magic, 1, sizeof(magic), file) != sizeof(magic) || memcmp(magic, AppenderBinary::FILE_MAGIC, sizeof(magic)) != 0
+        || fread(&version, 1, 1, file) != 1 || version != AppenderBinary::FILE_VERSION)
+    {
+        printf("%s is not a binary log file of version %u\n", argv[1], uint32(AppenderBinary::FILE_VERSION));
+        fclose(file);
+        return 1;
+    }
+
+    std::vector<char> payload;
+    uint64 records = 0;
+    uint32 size = 0;
+    while (Read(file, size))
+    {
+        int64 time = 0;
+        uint8 level = 0;
+        uint8 typeLength = 0;
+        if (size < AppenderBinary::RECORD_FIXED_SIZE || !Read(file, time) || !Read(file, level) || !Read(file, typeLength))
+        {
+            printf("Truncated record after %llu records\n", (unsigned long long)records);
+            break;
+        }
+
+        uint32 payloadSize = size - AppenderBinary::RECORD_FIXED_SIZE;
+        payload.resize(payloadSize);
+        if (payloadSize < typeLength || fread(payload.data(), 1, payloadSize, file) != payloadSize)
+        {
+            printf("Truncated record after %llu records\n", (unsigned long long)records);
+            break;
+        }
+
+        ++records;
+
+        std::string_view type(payload.data(), typeLength);
+        std::string_view text(payload.data() + typeLength, payloadSize - typeLength);
+        if (level > maxLevel || type.substr(0, typePrefix.size()) != typePrefix)
+            continue;
+
+        printf("%s %-5s [%.*s] %.*s\n", Acore::Time::TimeToTimestampStr(Seconds(time), "%Y-%m-%d %X").c_str(), GetLevelString(level),
+            int(type.size()), type.data(), int(text.size()), text.data());
+    }
+
+    fclose(file);
+    return 0;
+}
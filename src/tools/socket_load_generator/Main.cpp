@@ -0,0 +1,325 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Opens many fake client connections against a worldserver to measure how fast its network threads
+ * accept them. Every connection waits for SMSG_AUTH_CHALLENGE and then stays idle, so the run also
+ * shows what idle sockets cost the server. With a server pid (Linux only) the CPU time of every
+ * server thread is sampled over the run.
+ */
+
+#include "Define.h"
+#include "StringConvert.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <filesystem>
+#include <unistd.h>
+#endif
+
+using boost::asio::ip::tcp;
+
+namespace
+{
+    constexpr uint16 SMSG_AUTH_CHALLENGE = 0x1EC;
+
+    struct LoadStatistics
+    {
+        std::atomic<uint32> Connected{0};
+        std::atomic<uint32> Challenged{0};
+        std::atomic<uint32> Failed{0};
+        std::atomic<uint32> Disconnected{0};
+
+        std::mutex LatencyLock;
+        std::vector<uint32> ChallengeLatencies; // microseconds from connect() to SMSG_AUTH_CHALLENGE
+    };
+
+    class FakeClient : public std::enable_shared_from_this<FakeClient>
+    {
+    public:
+        FakeClient(boost::asio::io_context& ioContext, LoadStatistics& statistics) : _socket(ioContext), _statistics(statistics) { }
+
+        void Start(tcp::endpoint const& endpoint)
+        {
+            _connectTime = std::chrono::steady_clock::now();
+            _socket.async_connect(endpoint, [self = shared_from_this()](boost::system::error_code error)
+            {
+                self->HandleConnect(error);
+            });
+        }
+
+        void Close()
+        {
+            boost::system::error_code error;
+            _socket.close(error);
+        }
+
+    private:
+        void HandleConnect(boost::system::error_code error)
+        {
+            if (error)
+            {
+                ++_statistics.Failed;
+                return;
+            }
+
+            ++_statistics.Connected;
+            boost::asio::async_read(_socket, boost::asio::buffer(_header), [self = shared_from_this()](boost::system::error_code error, std::size_t /*transferredBytes*/)
+            {
+                self->HandleHeader(error);
+            });
+        }
+
+        void HandleHeader(boost::system::error_code error)
+        {
+            // server header: uint16 size (big endian, opcode included), uint16 opcode (little endian)
+            uint16 opcode = uint16(_header[2] | (_header[3] << 8));
+            if (error || opcode != SMSG_AUTH_CHALLENGE)
+            {
+                ++_statistics.Failed;
+                return;
+            }
+
+            uint32 latency = uint32(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - _connectTime).count());
+            {
+                std::lock_guard<std::mutex> lock(_statistics.LatencyLock);
+                _statistics.ChallengeLatencies.push_back(latency);
+            }
+
+            ++_statistics.Challenged;
+            Drain();
+        }
+
+        // the client never answers the challenge, only notice when the server drops the connection
+        void Drain()
+        {
+            _socket.async_read_some(boost::asio::buffer(_drainBuffer), [self = shared_from_this()](boost::system::error_code error, std::size_t /*transferredBytes*/)
+            {
+                if (error)
+                {
+                    if (error != boost::asio::error::operation_aborted)
+                        ++self->_statistics.Disconnected;
+
+                    return;
+                }
+
+                self->Drain();
+            });
+        }
+
+        tcp::socket _socket;
+        LoadStatistics& _statistics;
+        std::chrono::steady_clock::time_point _connectTime;
+        std::array<uint8, 4> _header = { };
+        std::array<uint8, 512> _drainBuffer = { };
+    };
+
+    struct ThreadCpuTime
+    {
+        std::string Name;
+        uint64 Ticks = 0;
+    };
+
+    /// utime + stime of every thread of the given process, empty when not available
+    std::map<uint32, ThreadCpuTime> SampleThreadCpuTimes(uint32 pid)
+    {
+        std::map<uint32, ThreadCpuTime> threads;
+#ifdef __linux__
+        std::error_code error;
+        for (auto const& task : std::filesystem::directory_iterator("/proc/" + std::to_string(pid) + "/task", error))
+        {
+            std::ifstream statFile(task.path() / "stat");
+            std::string stat((std::istreambuf_iterator<char>(statFile)), std::istreambuf_iterator<char>());
+
+            // the thread name may contain spaces, fields are counted from the closing parenthesis
+            std::size_t nameStart = stat.find('(');
+            std::size_t nameEnd = stat.rfind(')');
+            if (nameStart == std::string::npos || nameEnd == std::string::npos)
+                continue;
+
+            std::vector<std::string> fields;
+            std::size_t pos = nameEnd + 2;
+            while (pos < stat.size())
+            {
+                std::size_t next = stat.find(' ', pos);
+                if (next == std::string::npos)
+                    next = stat.size();
+
+                fields.push_back(stat.substr(pos, next - pos));
+                pos = next + 1;
+            }
+
+            // fields[0] is field 3 (state), utime and stime are fields 14 and 15
+            if (fields.size() < 13)
+                continue;
+
+            ThreadCpuTime& thread = threads[Acore::StringTo<uint32>(task.path().filename().string()).value_or(0)];
+            thread.Name = stat.substr(nameStart + 1, nameEnd - nameStart - 1);
+            thread.Ticks = Acore::StringTo<uint64>(fields[11]).value_or(0) + Acore::StringTo<uint64>(fields[12]).value_or(0);
+        }
+#else
+        (void)pid;
+#endif
+        return threads;
+    }
+
+    void PrintThreadCpuUsage(std::map<uint32, ThreadCpuTime> const& before, std::map<uint32, ThreadCpuTime> const& after, double seconds)
+    {
+#ifdef __linux__
+        double ticksPerSecond = double(sysconf(_SC_CLK_TCK));
+        printf("Server thread CPU usage over %.1f s:\n", seconds);
+        for (auto const& [tid, thread] : after)
+        {
+            auto itr = before.find(tid);
+            uint64 ticks = thread.Ticks - (itr != before.end() ? itr->second.Ticks : 0);
+            printf("  %8u %-16s %6.2f%%\n", tid, thread.Name.c_str(), ticks / ticksPerSecond / seconds * 100.0);
+        }
+#else
+        (void)before;
+        (void)after;
+        (void)seconds;
+        printf("Thread CPU sampling is only available on Linux\n");
+#endif
+    }
+
+    uint32 GetPercentile(std::vector<uint32> const& sorted, uint32 percentile)
+    {
+        if (sorted.empty())
+            return 0;
+
+        return sorted[std::min<std::size_t>(sorted.size() - 1, sorted.size() * percentile / 100)];
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 4)
+    {
+        printf("Usage: %s <host> <port> <connections> [threads = 1] [hold seconds = 30] [server pid]\n", argv[0]);
+        return 1;
+    }
+
+    std::string host = argv[1];
+    Optional<uint16> port = Acore::StringTo<uint16>(argv[2]);
+    Optional<uint32> connections = Acore::StringTo<uint32>(argv[3]);
+    uint32 threadCount = argc > 4 ? Acore::StringTo<uint32>(argv[4]).value_or(1) : 1;
+    uint32 holdSeconds = argc > 5 ? Acore::StringTo<uint32>(argv[5]).value_or(30) : 30;
+    Optional<uint32> serverPid = argc > 6 ? Acore::StringTo<uint32>(argv[6]) : Optional<uint32>();
+
+    if (!port || !connections || !*connections || !threadCount)
+    {
+        printf("Invalid port, connection count or thread count\n");
+        return 1;
+    }
+
+    boost::system::error_code error;
+    boost::asio::io_context resolverContext;
+    tcp::resolver resolver(resolverContext);
+    auto endpoints = resolver.resolve(host, std::to_string(*port), error);
+    if (error || endpoints.empty())
+    {
+        printf("Could not resolve %s: %s\n", host.c_str(), error.message().c_str());
+        return 1;
+    }
+
+    tcp::endpoint endpoint = *endpoints.begin();
+
+    LoadStatistics statistics;
+    statistics.ChallengeLatencies.reserve(*connections);
+
+    std::vector<std::unique_ptr<boost::asio::io_context>> ioContexts;
+    for (uint32 i = 0; i < threadCount; ++i)
+        ioContexts.push_back(std::make_unique<boost::asio::io_context>(1));
+
+    std::vector<std::shared_ptr<FakeClient>> clients;
+    clients.reserve(*connections);
+    for (uint32 i = 0; i < *connections; ++i)
+        clients.push_back(std::make_shared<FakeClient>(*ioContexts[i % threadCount], statistics));
+
+    std::map<uint32, ThreadCpuTime> cpuBefore;
+    if (serverPid)
+        cpuBefore = SampleThreadCpuTimes(*serverPid);
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::shared_ptr<FakeClient> const& client : clients)
+        client->Start(endpoint);
+
+    std::vector<std::thread> threads;
+    for (std::unique_ptr<boost::asio::io_context>& ioContext : ioContexts)
+    {
+        threads.emplace_back([&ioContext]()
+        {
+            auto work = boost::asio::make_work_guard(*ioContext);
+            ioContext->run();
+        });
+    }
+
+    // wait until every connection was either challenged or failed
+    while (statistics.Challenged + statistics.Failed < *connections && std::chrono::steady_clock::now() - start < std::chrono::seconds(60))
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    double establishSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<uint32> latencies;
+    {
+        std::lock_guard<std::mutex> lock(statistics.LatencyLock);
+        latencies = statistics.ChallengeLatencies;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    printf("Connections: %u requested, %u connected, %u challenged, %u failed\n", *connections,
+        statistics.Connected.load(), statistics.Challenged.load(), statistics.Failed.load());
+    printf("Accept rate: %.0f connections/s over %.2f s\n", statistics.Challenged / establishSeconds, establishSeconds);
+    printf("Challenge latency (us): p50 %u, p90 %u, p99 %u, max %u\n", GetPercentile(latencies, 50), GetPercentile(latencies, 90),
+        GetPercentile(latencies, 99), latencies.empty() ? 0 : latencies.back());
+
+    printf("Holding idle connections for %u s...\n", holdSeconds);
+    std::this_thread::sleep_for(std::chrono::seconds(holdSeconds));
+
+    double totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("Connections dropped by the server: %u\n", statistics.Disconnected.load());
+
+    if (serverPid)
+        PrintThreadCpuUsage(cpuBefore, SampleThreadCpuTimes(*serverPid), totalSeconds);
+
+    for (std::unique_ptr<boost::asio::io_context>& ioContext : ioContexts)
+        ioContext->stop();
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (std::shared_ptr<FakeClient> const& client : clients)
+        client->Close();
+
+    return 0;
+}
@@ -0,0 +1,562 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Bakes waypoint_data paths against the mmaps written by mmaps_generator. For every pair of consecutive
+ * nodes (and from the last node back to the first) the navmesh corridor is searched once and stored as
+ * a point list sampled like PathGenerator does it, the worldserver replays those lists instead of asking
+ * Detour again. The corridor may cross water, its navmesh flags are stored with the points so only
+ * creatures allowed there replay it.
+ * Segments that leave the navmesh or only reach their node partially are written without points and
+ * listed in the report, the worldserver keeps pathing them at runtime.
+ *
+ * The waypoints are read from a tab separated export, see the usage text for the query.
+ */
+
+#include "DetourCommon.h"
+#include "DetourNavMesh.h"
+#include "DetourNavMeshQuery.h"
+#include "MapDefines.h"
+#include "StringConvert.h"
+#include "StringFormat.h"
+#include "Tokenize.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr char BakedMagic[4] = { 'W', 'P', 'B', 'K' };
+    constexpr uint32 BakedVersion = 2;                     // keep in sync with WaypointMgr::LoadBakedPaths
+
+    constexpr uint32 MAX_PATH_POLYS = 512;
+    constexpr uint32 MAX_PATH_POINTS = 256;
+    constexpr uint32 VERTEX_SIZE = 3;
+    constexpr float SMOOTH_PATH_STEP_SIZE = 4.0f;          // keep in sync with PathGenerator.h
+    constexpr float SMOOTH_PATH_SLOP = 0.3f;
+    constexpr float MAX_NODE_DISTANCE = 3.0f;              // from a node to the closest navmesh point
+
+    struct Node
+    {
+        uint32 Point;
+        float X, Y, Z;
+    };
+
+    struct Path
+    {
+        uint32 MapId = 0;
+        std::vector<Node> Nodes;
+    };
+
+    struct Segment
+    {
+        Node const* From;
+        Node const* To;
+        std::vector<float> Points;                         // x, y, z in game coordinates
+        uint16 NavFlags = 0;                               // NavTerrainFlag of the polygons the path crosses
+        char const* Error = nullptr;
+    };
+
+    bool InRangeYZX(float const* v1, float const* v2, float r, float h)
+    {
+        float const dx = v2[0] - v1[0];
+        float const dy = v2[1] - v1[1]; // elevation
+        float const dz = v2[2] - v1[2];
+        return (dx * dx + dz * dz) < r * r && std::fabs(dy) < h;
+    }
+
+    // see PathGenerator::FixupCorridor
+    uint32 FixupCorridor(dtPolyRef* path, uint32 npath, uint32 maxPath, dtPolyRef const* visited, uint32 nvisited)
+    {
+        int32 furthestPath = -1;
+        int32 furthestVisited = -1;
+
+        // Find furthest common polygon.
+        for (int32 i = npath - 1; i >= 0; --i)
+        {
+            bool found = false;
+            for (int32 j = nvisited - 1; j >= 0; --j)
+            {
+                if (path[i] == visited[j])
+                {
+                    furthestPath = i;
+                    furthestVisited = j;
+                    found = true;
+                }
+            }
+            if (found)
+                break;
+        }
+
+        // If no intersection found just return current path.
+        if (furthestPath == -1 || furthestVisited == -1)
+            return npath;
+
+        // Adjust beginning of the buffer to include the visited.
+        uint32 req = nvisited - furthestVisited;
+        uint32 orig = uint32(furthestPath + 1) < npath ? furthestPath + 1 : npath;
+        uint32 size = npath > orig ? npath - orig : 0;
+        if (req + size > maxPath)
+            size = maxPath - req;
+
+        if (size)
+            memmove(path + req, path + orig, size * sizeof(dtPolyRef));
+
+        // Store visited
+        for (uint32 i = 0; i < req; ++i)
+            path[i] = visited[(nvisited - 1) - i];
+
+        return req + size;
+    }
+
+    class NavMesh
+    {
+    public:
+        ~NavMesh()
+        {
+            dtFreeNavMeshQuery(_query);
+            dtFreeNavMesh(_mesh);
+        }
+
+        bool Load(std::string const& dataDir, uint32 mapId)
+        {
+            std::string fileName = dataDir + "/mmaps/" + Acore::StringFormat("{:03}.mmap", mapId);
+            FILE* file = fopen(fileName.c_str(), "rb");
+            if (!file)
+                return false;
+
+            dtNavMeshParams params;
+            bool read = fread(&params, sizeof(params), 1, file) == 1;
+            fclose(file);
+
+            _mesh = dtAllocNavMesh();
+            if (!read || dtStatusFailed(_mesh->init(&params)))
+                return false;
+
+            for (int32 x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
+                for (int32 y = 0; y < MAX_NUMBER_OF_GRIDS; ++y)
+                    LoadTile(dataDir, mapId, x, y);
+
+            _query = dtAllocNavMeshQuery();
+            return _tiles && dtStatusSucceed(_query->init(_mesh, 65535));
+        }
+
+        [[nodiscard]] uint32 GetTileCount() const { return _tiles; }
+
+        char const* FindPath(Segment& segment) const
+        {
+            // recast uses y, z, x
+            float start[VERTEX_SIZE] = { segment.From->Y, segment.From->Z, segment.From->X };
+            float end[VERTEX_SIZE] = { segment.To->Y, segment.To->Z, segment.To->X };
+            float extents[VERTEX_SIZE] = { MAX_NODE_DISTANCE, 5.0f, MAX_NODE_DISTANCE };
+
+            // what a swimming creature may use, the worldserver checks the stored flags against the creature
+            dtQueryFilter filter;
+            filter.setIncludeFlags(NAV_GROUND | NAV_WATER);
+            filter.setExcludeFlags(NAV_MAGMA | NAV_SLIME);
+
+            dtPolyRef startRef = 0, endRef = 0;
+            float startPoint[VERTEX_SIZE], endPoint[VERTEX_SIZE];
+            if (dtStatusFailed(_query->findNearestPoly(start, extents, &filter, &startRef, startPoint)) || !startRef)
+                return "start node is off the navmesh";
+
+            if (dtStatusFailed(_query->findNearestPoly(end, extents, &filter, &endRef, endPoint)) || !endRef)
+                return "end node is off the navmesh";
+
+            dtPolyRef polys[MAX_PATH_POLYS];
+            int32 polyCount = 0;
+            dtStatus status = _query->findPath(startRef, endRef, startPoint, endPoint, &filter, polys, &polyCount, MAX_PATH_POLYS);
+            if (dtStatusFailed(status) || !polyCount)
+                return "no navmesh path";
+
+            if (dtStatusDetail(status, DT_PARTIAL_RESULT) || polys[polyCount - 1] != endRef)
+                return "navmesh path only reaches part of the way";
+
+            for (int32 i = 0; i < polyCount; ++i)
+            {
+                uint16 flags = 0;
+                if (dtStatusSucceed(_mesh->getPolyFlags(polys[i], &flags)))
+                    segment.NavFlags |= flags;
+            }
+
+            float points[MAX_PATH_POINTS * VERTEX_SIZE];
+            uint32 pointCount = 0;
+            if (char const* error = FindSmoothPath(startPoint, endPoint, polys, polyCount, filter, points, pointCount))
+                return error;
+
+            segment.Points.reserve(pointCount * VERTEX_SIZE);
+            for (uint32 i = 0; i < pointCount; ++i)
+            {
+                segment.Points.push_back(points[i * VERTEX_SIZE + 2]);
+                segment.Points.push_back(points[i * VERTEX_SIZE + 0]);
+                segment.Points.push_back(points[i * VERTEX_SIZE + 1]);
+            }
+
+            return nullptr;
+        }
+
+    private:
+        void LoadTile(std::string const& dataDir, uint32 mapId, int32 x, int32 y)
+        {
+            std::string fileName = dataDir + "/mmaps/" + Acore::StringFormat("{:03}{:02}{:02}.mmtile", mapId, x, y);
+            FILE* file = fopen(fileName.c_str(), "rb");
+            if (!file)
+                return;
+
+            MmapTileHeader header;
+            if (fread(&header, sizeof(header), 1, file) != 1 || header.mmapMagic != MMAP_MAGIC || header.mmapVersion != MMAP_VERSION)
+            {
+                printf("Skipping %s, bad header or generator version\n", fileName.c_str());
+                fclose(file);
+                return;
+            }
+
+            unsigned char* data = static_cast<unsigned char*>(dtAlloc(header.size, DT_ALLOC_PERM));
+            bool read = fread(data, header.size, 1, file) == 1;
+            fclose(file);
+
+            if (!read || dtStatusFailed(_mesh->addTile(data, header.size, DT_TILE_FREE_DATA, 0, nullptr)))
+            {
+                dtFree(data);
+                return;
+            }
+
+            ++_tiles;
+        }
+
+        // same sampling as PathGenerator::FindSmoothPath, a point every SMOOTH_PATH_STEP_SIZE at navmesh height
+        char const* FindSmoothPath(float const* startPos, float const* endPos, dtPolyRef const* polyPath, uint32 polyPathSize,
+            dtQueryFilter const& filter, float* smoothPath, uint32& smoothPathSize) const
+        {
+            smoothPathSize = 0;
+
+            dtPolyRef polys[MAX_PATH_POLYS];
+            memcpy(polys, polyPath, sizeof(dtPolyRef) * polyPathSize);
+            uint32 npolys = polyPathSize;
+
+            float iterPos[VERTEX_SIZE], targetPos[VERTEX_SIZE];
+            if (polyPathSize > 1)
+            {
+                // Pick the closest points on poly border
+                if (dtStatusFailed(_query->closestPointOnPolyBoundary(polys[0], startPos, iterPos))
+                    || dtStatusFailed(_query->closestPointOnPolyBoundary(polys[npolys - 1], endPos, targetPos)))
+                    return "no point on the corridor border";
+            }
+            else
+            {
+                // Case where the path is on the same poly
+                dtVcopy(iterPos, startPos);
+                dtVcopy(targetPos, endPos);
+            }
+
+            dtVcopy(&smoothPath[smoothPathSize++ * VERTEX_SIZE], iterPos);
+
+            // Move towards target a small advancement at a time until target reached
+            while (npolys)
+            {
+                if (smoothPathSize >= MAX_PATH_POINTS)
+                    return "path has too many points";
+
+                // Find location to steer towards.
+                float steerPos[VERTEX_SIZE];
+                unsigned char steerPosFlag;
+                dtPolyRef steerPosRef = 0;
+                if (!GetSteerTarget(iterPos, targetPos, polys, npolys, steerPos, steerPosFlag, steerPosRef))
+                    break;
+
+                bool endOfPath = (steerPosFlag & DT_STRAIGHTPATH_END) != 0;
+                bool offMeshConnection = (steerPosFlag & DT_STRAIGHTPATH_OFFMESH_CONNECTION) != 0;
+
+                // Find movement delta.
+                float delta[VERTEX_SIZE];
+                dtVsub(delta, steerPos, iterPos);
+                float len = dtMathSqrtf(dtVdot(delta, delta));
+                // If the steer target is end of path or off-mesh link, do not move past the location.
+                if ((endOfPath || offMeshConnection) && len < SMOOTH_PATH_STEP_SIZE)
+                    len = 1.0f;
+                else
+                    len = SMOOTH_PATH_STEP_SIZE / len;
+
+                float moveTgt[VERTEX_SIZE];
+                dtVmad(moveTgt, iterPos, delta, len);
+
+                // Move
+                float result[VERTEX_SIZE];
+                constexpr uint32 MAX_VISIT_POLY = 16;
+                dtPolyRef visited[MAX_VISIT_POLY];
+                int32 nvisited = 0;
+                if (dtStatusFailed(_query->moveAlongSurface(polys[0], iterPos, moveTgt, &filter, result, visited, &nvisited, MAX_VISIT_POLY)))
+                    return "could not move along the navmesh";
+
+                npolys = FixupCorridor(polys, npolys, MAX_PATH_POLYS, visited, nvisited);
+
+                _query->getPolyHeight(polys[0], result, &result[1]);
+                result[1] += 0.5f;
+                dtVcopy(iterPos, result);
+
+                // Handle end of path and off-mesh links when close enough.
+                if (endOfPath && InRangeYZX(iterPos, steerPos, SMOOTH_PATH_SLOP, 1.0f))
+                {
+                    // Reached end of path.
+                    dtVcopy(&smoothPath[smoothPathSize++ * VERTEX_SIZE], targetPos);
+                    break;
+                }
+                else if (offMeshConnection && InRangeYZX(iterPos, steerPos, SMOOTH_PATH_SLOP, 1.0f))
+                {
+                    // Advance the path up to and over the off-mesh connection.
+                    dtPolyRef prevRef = 0;
+                    dtPolyRef polyRef = polys[0];
+                    uint32 npos = 0;
+                    while (npos < npolys && polyRef != steerPosRef)
+                    {
+                        prevRef = polyRef;
+                        polyRef = polys[npos];
+                        npos++;
+                    }
+
+                    for (uint32 i = npos; i < npolys; ++i)
+                        polys[i - npos] = polys[i];
+
+                    npolys -= npos;
+
+                    // Handle the connection.
+                    float connectionStartPos[VERTEX_SIZE], connectionEndPos[VERTEX_SIZE];
+                    if (dtStatusSucceed(_mesh->getOffMeshConnectionPolyEndPoints(prevRef, polyRef, connectionStartPos, connectionEndPos)))
+                    {
+                        dtVcopy(&smoothPath[smoothPathSize++ * VERTEX_SIZE], connectionStartPos);
+                        if (smoothPathSize >= MAX_PATH_POINTS)
+                            return "path has too many points";
+
+                        // Move position at the other side of the off-mesh link.
+                        dtVcopy(iterPos, connectionEndPos);
+                        if (dtStatusFailed(_query->getPolyHeight(polys[0], iterPos, &iterPos[1])))
+                            return "no navmesh height behind an off-mesh connection";
+
+                        iterPos[1] += 0.5f;
+                    }
+                }
+
+                // Store results.
+                dtVcopy(&smoothPath[smoothPathSize++ * VERTEX_SIZE], iterPos);
+            }
+
+            if (smoothPathSize < 2)
+                return "no smooth path";
+
+            return nullptr;
+        }
+
+        bool GetSteerTarget(float const* startPos, float const* endPos, dtPolyRef const* path, uint32 pathSize,
+            float* steerPos, unsigned char& steerPosFlag, dtPolyRef& steerPosRef) const
+        {
+            // Find steer target.
+            constexpr uint32 MAX_STEER_POINTS = 3;
+            float steerPath[MAX_STEER_POINTS * VERTEX_SIZE];
+            unsigned char steerPathFlags[MAX_STEER_POINTS];
+            dtPolyRef steerPathPolys[MAX_STEER_POINTS];
+            int32 nsteerPath = 0;
+            dtStatus status = _query->findStraightPath(startPos, endPos, path, pathSize, steerPath, steerPathFlags, steerPathPolys, &nsteerPath, MAX_STEER_POINTS);
+            if (!nsteerPath || dtStatusFailed(status))
+                return false;
+
+            // Find vertex far enough to steer to.
+            int32 ns = 0;
+            while (ns < nsteerPath)
+            {
+                // Stop at Off-Mesh link or when point is further than slop away.
+                if ((steerPathFlags[ns] & DT_STRAIGHTPATH_OFFMESH_CONNECTION) ||
+                    !InRangeYZX(&steerPath[ns * VERTEX_SIZE], startPos, SMOOTH_PATH_SLOP, 1000.0f))
+                    break;
+
+                ns++;
+            }
+
+            // Failed to find good point to steer to.
+            if (ns >= nsteerPath)
+                return false;
+
+            dtVcopy(steerPos, &steerPath[ns * VERTEX_SIZE]);
+            steerPos[1] = startPos[1];  // keep Z value
+            steerPosFlag = steerPathFlags[ns];
+            steerPosRef = steerPathPolys[ns];
+            return true;
+        }
+
+        dtNavMesh* _mesh = nullptr;
+        dtNavMeshQuery* _query = nullptr;
+        uint32 _tiles = 0;
+    };
+
+    // map, path id, point, x, y, z per line
+    bool ReadWaypoints(char const* fileName, std::map<uint32, Path>& paths)
+    {
+        std::ifstream file(fileName);
+        if (!file)
+            return false;
+
+        std::string line;
+        uint32 lineNumber = 0;
+        while (std::getline(file, line))
+        {
+            ++lineNumber;
+            std::vector<std::string_view> tokens = Acore::Tokenize(line, '\t', false);
+            if (tokens.empty())
+                continue;
+
+            Optional<uint32> mapId = tokens.size() == 6 ? Acore::StringTo<uint32>(tokens[0]) : Optional<uint32>();
+            Optional<uint32> pathId = tokens.size() == 6 ? Acore::StringTo<uint32>(tokens[1]) : Optional<uint32>();
+            Optional<uint32> point = tokens.size() == 6 ? Acore::StringTo<uint32>(tokens[2]) : Optional<uint32>();
+            Optional<float> x = tokens.size() == 6 ? Acore::StringTo<float>(tokens[3]) : Optional<float>();
+            Optional<float> y = tokens.size() == 6 ? Acore::StringTo<float>(tokens[4]) : Optional<float>();
+            Optional<float> z = tokens.size() == 6 ? Acore::StringTo<float>(tokens[5]) : Optional<float>();
+            if (!mapId || !pathId || !point || !x || !y || !z)
+            {
+                printf("%s:%u: expected map, path id, point, x, y, z\n", fileName, lineNumber);
+                return false;
+            }
+
+            Path& path = paths[*pathId];
+            if (!path.Nodes.empty() && path.MapId != *mapId)
+            {
+                printf("%s:%u: path %u is used on maps %u and %u, only the first one is baked\n", fileName, lineNumber, *pathId, path.MapId, *mapId);
+                continue;
+            }
+
+            // one path can be used by several spawns, the export repeats its nodes then
+            if (!path.Nodes.empty() && path.Nodes.back().Point >= *point)
+                continue;
+
+            path.MapId = *mapId;
+            path.Nodes.push_back({ *point, *x, *y, *z });
+        }
+
+        return true;
+    }
+
+    template<typename T>
+    void Write(std::ofstream& file, T const& value)
+    {
+        file.write(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 4)
+    {
+        printf("Usage: %s <waypoints.tsv> <data dir> <output file>\n\n", argv[0]);
+        printf("Export the waypoints of creatures spawned with a path, for example with\n");
+        printf("  mysql -N -B acore_world -e \"SELECT DISTINCT c.map, w.id, w.point, w.position_x, w.position_y, w.position_z\n");
+        printf("    FROM waypoint_data w JOIN creature_addon a ON a.path_id = w.id JOIN creature c ON c.guid = a.guid\n");
+        printf("    WHERE w.move_type < 4 ORDER BY w.id, w.point\" > waypoints.tsv\n");
+        printf("and point the worldserver option WaypointBakedPathsFile at the output file.\n");
+        return 1;
+    }
+
+    std::map<uint32, Path> paths;
+    if (!ReadWaypoints(argv[1], paths))
+    {
+        printf("Could not read waypoints from %s\n", argv[1]);
+        return 1;
+    }
+
+    std::map<uint32, std::vector<uint32>> pathsByMap;
+    for (auto const& [pathId, path] : paths)
+        if (path.Nodes.size() > 1)
+            pathsByMap[path.MapId].push_back(pathId);
+
+    std::ofstream output(argv[3], std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!output)
+    {
+        printf("Could not open %s for writing\n", argv[3]);
+        return 1;
+    }
+
+    output.write(BakedMagic, sizeof(BakedMagic));
+    Write(output, BakedVersion);
+    Write(output, uint32(0));                              // path count, written at the end
+
+    uint32 bakedPaths = 0, bakedSegments = 0, brokenPaths = 0, brokenSegments = 0;
+    for (auto const& [mapId, pathIds] : pathsByMap)
+    {
+        NavMesh navMesh;
+        if (!navMesh.Load(argv[2], mapId))
+        {
+            printf("Map %03u: no mmaps, %u paths skipped\n", mapId, uint32(pathIds.size()));
+            continue;
+        }
+
+        printf("Map %03u: %u tiles, %u paths\n", mapId, navMesh.GetTileCount(), uint32(pathIds.size()));
+
+        for (uint32 pathId : pathIds)
+        {
+            Path const& path = paths[pathId];
+
+            // segment i ends at node i, the first one starts at the last node for repeating paths
+            std::vector<Segment> segments;
+            segments.reserve(path.Nodes.size());
+            bool broken = false;
+            for (std::size_t i = 0; i < path.Nodes.size(); ++i)
+            {
+                Segment& segment = segments.emplace_back();
+                segment.From = &path.Nodes[i ? i - 1 : path.Nodes.size() - 1];
+                segment.To = &path.Nodes[i];
+                segment.Error = navMesh.FindPath(segment);
+                if (segment.Error)
+                {
+                    printf("  path %u, point %u -> %u: %s\n", pathId, segment.From->Point, segment.To->Point, segment.Error);
+                    ++brokenSegments;
+                    broken = true;
+                }
+                else
+                    ++bakedSegments;
+            }
+
+            Write(output, pathId);
+            Write(output, mapId);
+            Write(output, uint32(segments.size()));
+            for (Segment const& segment : segments)
+            {
+                float nodes[6] = { segment.From->X, segment.From->Y, segment.From->Z, segment.To->X, segment.To->Y, segment.To->Z };
+                output.write(reinterpret_cast<char const*>(nodes), sizeof(nodes));
+                Write(output, uint32(segment.NavFlags));
+                Write(output, uint32(segment.Points.size() / VERTEX_SIZE));
+                output.write(reinterpret_cast<char const*>(segment.Points.data()), segment.Points.size() * sizeof(float));
+            }
+
+            ++bakedPaths;
+            if (broken)
+                ++brokenPaths;
+        }
+    }
+
+    output.seekp(sizeof(BakedMagic) + sizeof(BakedVersion));
+    Write(output, bakedPaths);
+
+    if (!output)
+    {
+        printf("Could not write %s\n", argv[3]);
+        return 1;
+    }
+
+    printf("\nBaked %u paths with %u segments, %u paths have %u broken segments\n", bakedPaths, bakedSegments, brokenPaths, brokenSegments);
+    return 0;
+}